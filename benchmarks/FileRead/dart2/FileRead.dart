@@ -0,0 +1,92 @@
+// Copyright (c) 2022, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+//
+// Measures the throughput of asynchronous file reads, which are served by
+// the IO service. Reading many small files is dominated by the number of
+// requests per file, streaming a large file by the cost per chunk.
+
+// @dart=2.9
+
+import 'dart:async';
+import 'dart:io';
+import 'dart:typed_data';
+
+import 'package:benchmark_harness/benchmark_harness.dart';
+
+class ReadSmallFiles extends AsyncBenchmarkBase {
+  ReadSmallFiles(this.fileCount, this.fileSize)
+      : super('FileRead.SmallFiles$fileCount.Bytes$fileSize');
+
+  @override
+  Future<void> setup() async {
+    directory = Directory.systemTemp.createTempSync('FileRead');
+    final contents = Uint8List(fileSize);
+    for (int i = 0; i < fileCount; i++) {
+      final file = File('${directory.path}/$i');
+      file.writeAsBytesSync(contents);
+      files.add(file);
+    }
+  }
+
+  @override
+  Future<void> teardown() async {
+    directory.deleteSync(recursive: true);
+  }
+
+  @override
+  Future<void> run() async {
+    // Keep a bounded number of reads in flight, as a server would.
+    const int concurrency = 64;
+    int next = 0;
+    Future<void> reader() async {
+      while (next < files.length) {
+        final bytes = await files[next++].readAsBytes();
+        if (bytes.length != fileSize) throw 'Unexpected length';
+      }
+    }
+
+    await Future.wait(<Future<void>>[
+      for (int i = 0; i < concurrency; i++) reader(),
+    ]);
+  }
+
+  final int fileCount;
+  final int fileSize;
+  final List<File> files = <File>[];
+  Directory directory;
+}
+
+class StreamLargeFile extends AsyncBenchmarkBase {
+  StreamLargeFile(this.fileSize) : super('FileRead.Stream.Bytes$fileSize');
+
+  @override
+  Future<void> setup() async {
+    directory = Directory.systemTemp.createTempSync('FileRead');
+    file = File('${directory.path}/large');
+    file.writeAsBytesSync(Uint8List(fileSize));
+  }
+
+  @override
+  Future<void> teardown() async {
+    directory.deleteSync(recursive: true);
+  }
+
+  @override
+  Future<void> run() async {
+    int length = 0;
+    await for (final chunk in file.openRead()) {
+      length += chunk.length;
+    }
+    if (length != fileSize) throw 'Unexpected length';
+  }
+
+  final int fileSize;
+  Directory directory;
+  File file;
+}
+
+Future<void> main() async {
+  await ReadSmallFiles(10000, 256).report();
+  await StreamLargeFile(64 * 1024 * 1024).report();
+}
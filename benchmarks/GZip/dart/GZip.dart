@@ -0,0 +1,105 @@
+// Copyright (c) 2022, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+//
+// Measures gzip throughput on text resembling HTTP response bodies. The
+// Encode and Decode variants convert a whole buffer at once, the Chunked
+// variant feeds the encoder the way an HttpResponse does.
+
+import 'dart:convert';
+import 'dart:io';
+import 'dart:math';
+import 'dart:typed_data';
+
+import 'package:benchmark_harness/benchmark_harness.dart';
+
+Uint8List makeBody(int size) {
+  final random = Random(42);
+  final buffer = StringBuffer('[');
+  while (buffer.length < size) {
+    buffer.write('{"id":${random.nextInt(1 << 30)},'
+        '"name":"item${random.nextInt(1000)}",'
+        '"price":${random.nextDouble().toStringAsFixed(2)},'
+        '"tags":["a${random.nextInt(10)}","b${random.nextInt(100)}"]},');
+  }
+  return Uint8List.fromList(utf8.encode(buffer.toString()).sublist(0, size));
+}
+
+class GZipEncode extends BenchmarkBase {
+  GZipEncode(this.size) : super('GZip.Encode.Bytes$size');
+
+  @override
+  void setup() {
+    body = makeBody(size);
+  }
+
+  @override
+  void run() {
+    if (gzip.encode(body).isEmpty) throw 'Bad result';
+  }
+
+  final int size;
+  late Uint8List body;
+}
+
+class GZipDecode extends BenchmarkBase {
+  GZipDecode(this.size) : super('GZip.Decode.Bytes$size');
+
+  @override
+  void setup() {
+    compressed = gzip.encode(makeBody(size));
+  }
+
+  @override
+  void run() {
+    if (gzip.decode(compressed).length != size) throw 'Bad result';
+  }
+
+  final int size;
+  late List<int> compressed;
+}
+
+class CountingSink implements Sink<List<int>> {
+  @override
+  void add(List<int> data) {
+    length += data.length;
+  }
+
+  @override
+  void close() {}
+
+  int length = 0;
+}
+
+class GZipEncodeChunked extends BenchmarkBase {
+  GZipEncodeChunked(this.size, this.chunkSize)
+      : super('GZip.EncodeChunked.Bytes$size.Chunk$chunkSize');
+
+  @override
+  void setup() {
+    body = makeBody(size);
+  }
+
+  @override
+  void run() {
+    final output = CountingSink();
+    final input = gzip.encoder.startChunkedConversion(output);
+    for (int start = 0; start < size; start += chunkSize) {
+      input.addSlice(body, start, min(start + chunkSize, size), false);
+    }
+    input.close();
+    if (output.length == 0) throw 'Bad result';
+  }
+
+  final int size;
+  final int chunkSize;
+  late Uint8List body;
+}
+
+void main() {
+  for (final size in const <int>[4 * 1024, 64 * 1024, 1024 * 1024]) {
+    GZipEncode(size).report();
+    GZipDecode(size).report();
+  }
+  GZipEncodeChunked(1024 * 1024, 16 * 1024).report();
+}
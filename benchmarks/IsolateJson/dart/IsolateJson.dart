@@ -123,6 +123,12 @@ Future<void> main() async {
   };
   final json1MB =
       utf8.encode(json.encode(decoded1MB)) as Uint8List; // 1177397 bytes
+  // Decodes to a graph that does not fit into new space.
+  final decoded16MB = <dynamic, dynamic>{
+    for (int i = 1; i <= 16; i++) '$i': decoded1MB,
+  };
+  final json16MB =
+      utf8.encode(json.encode(decoded16MB)) as Uint8List; // ~18.8 MB
   decoded['1'] = (decoded['1'] as List).sublist(0, 200);
   final json100KB =
       utf8.encode(json.encode(decoded)) as Uint8List; // 104685 bytes
@@ -135,6 +141,7 @@ Future<void> main() async {
     BenchmarkConfig('100KB', json100KB),
     BenchmarkConfig('250KB', json250KB),
     BenchmarkConfig('1MB', json1MB),
+    BenchmarkConfig('16MB', json16MB),
   ];
 
   for (final config in configs) {
@@ -125,6 +125,11 @@ Future<void> main() async {
     '4': decoded['1'],
   };
   final json1MB = utf8.encode(json.encode(decoded1MB)); // 1177397 bytes
+  // Decodes to a graph that does not fit into new space.
+  final decoded16MB = <dynamic, dynamic>{
+    for (int i = 1; i <= 16; i++) '$i': decoded1MB,
+  };
+  final json16MB = utf8.encode(json.encode(decoded16MB)); // ~18.8 MB
   decoded['1'] = (decoded['1'] as List).sublist(0, 200);
   final json100KB = utf8.encode(json.encode(decoded)); // 104685 bytes
   decoded['1'] = (decoded['1'] as List).sublist(0, 100);
@@ -135,6 +140,7 @@ Future<void> main() async {
     BenchmarkConfig('100KB', json100KB),
     BenchmarkConfig('250KB', json250KB),
     BenchmarkConfig('1MB', json1MB),
+    BenchmarkConfig('16MB', json16MB),
   ];
 
   for (final config in configs) {
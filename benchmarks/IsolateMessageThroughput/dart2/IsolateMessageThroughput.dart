@@ -0,0 +1,97 @@
+// Copyright (c) 2022, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+//
+// Measures how fast an isolate receives a stream of small messages sent by
+// one or more other isolates. The cost is dominated by the per-message work
+// of the receiving isolate's message handler rather than by serialization.
+//
+// Compare runs with different --message_batch_size values.
+
+// @dart=2.9
+
+import 'dart:async';
+import 'dart:isolate';
+
+import 'package:benchmark_harness/benchmark_harness.dart';
+
+const int messagesPerSender = 10000;
+
+Future<void> sender(List<Object> args) async {
+  final replyPort = args[0] as SendPort;
+  final kind = args[1] as String;
+  final message = messageOfKind(kind);
+  final commands = ReceivePort();
+  replyPort.send(commands.sendPort);
+  await for (final command in commands) {
+    if (command == null) break;
+    final sink = command as SendPort;
+    for (int i = 0; i < messagesPerSender; i++) {
+      sink.send(message);
+    }
+  }
+  commands.close();
+}
+
+Object messageOfKind(String kind) {
+  switch (kind) {
+    case 'Int':
+      return 42;
+    case 'String':
+      return 'temperature=21.5';
+    case 'List':
+      return <Object>[1, 'cpu', 0.75];
+  }
+  throw ArgumentError.value(kind, 'kind');
+}
+
+class IsolateMessageThroughput extends AsyncBenchmarkBase {
+  IsolateMessageThroughput(this.senders, this.kind)
+      : super('IsolateMessageThroughput.Senders$senders.$kind');
+
+  @override
+  Future<void> setup() async {
+    inbox.listen((_) {
+      if (++received == senders * messagesPerSender) {
+        received = 0;
+        done.complete();
+      }
+    });
+    for (int i = 0; i < senders; i++) {
+      final replies = ReceivePort();
+      await Isolate.spawn(sender, <Object>[replies.sendPort, kind]);
+      outboxes.add(await replies.first as SendPort);
+    }
+  }
+
+  @override
+  Future<void> teardown() async {
+    for (final outbox in outboxes) {
+      outbox.send(null);
+    }
+    inbox.close();
+  }
+
+  @override
+  Future<void> run() async {
+    done = Completer<void>();
+    for (final outbox in outboxes) {
+      outbox.send(inbox.sendPort);
+    }
+    await done.future;
+  }
+
+  final int senders;
+  final String kind;
+  final ReceivePort inbox = ReceivePort();
+  final List<SendPort> outboxes = <SendPort>[];
+  int received = 0;
+  Completer<void> done;
+}
+
+Future<void> main() async {
+  for (final kind in const <String>['Int', 'String', 'List']) {
+    await IsolateMessageThroughput(1, kind).report();
+  }
+  await IsolateMessageThroughput(8, 'Int').report();
+}
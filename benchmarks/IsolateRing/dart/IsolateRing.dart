@@ -0,0 +1,114 @@
+// Copyright (c) 2022, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+//
+// Spawns a few thousand small isolates connected in a ring and passes a token
+// around it. Every hop wakes up a different isolate, so the cost is dominated
+// by how quickly the thread pool gets message handler tasks onto a worker.
+//
+// The fan-out part sends a message to every isolate at once and waits for all
+// replies, which instead keeps all workers of the pool busy.
+
+import 'dart:async';
+import 'dart:io';
+import 'dart:isolate';
+import 'dart:math';
+
+import 'package:expect/expect.dart';
+
+const int nIsolates = 2000;
+const int nLaps = 10;
+const int nFanOuts = 10;
+
+// Forwards every message to [next], except for `null` which terminates the
+// node. A token whose lap counter reached zero is sent to [done] instead.
+void ringNode(List args) {
+  final SendPort done = args[0];
+  final SendPort fanOutReply = args[1];
+  final SendPort setup = args[2];
+  final inbox = ReceivePort();
+  late SendPort next;
+  bool first = true;
+  inbox.listen((message) {
+    if (first) {
+      next = message as SendPort;
+      first = false;
+      return;
+    }
+    if (message == null) {
+      inbox.close();
+    } else if (message is String) {
+      fanOutReply.send(message);
+    } else {
+      final int laps = message as int;
+      if (laps == 0) {
+        done.send(true);
+      } else {
+        next.send(laps - 1);
+      }
+    }
+  });
+  setup.send(inbox.sendPort);
+}
+
+Future<void> main() async {
+  final done = ReceivePort();
+  final doneIterator = StreamIterator(done);
+  final fanOutReplies = ReceivePort();
+  final fanOutIterator = StreamIterator(fanOutReplies);
+  final setup = ReceivePort();
+  final setupIterator = StreamIterator(setup);
+
+  final beforeRss = ProcessInfo.currentRss;
+  int maxRss = beforeRss;
+  final rssTimer = Timer.periodic(const Duration(milliseconds: 10), (_) {
+    maxRss = max(ProcessInfo.currentRss, maxRss);
+  });
+
+  final watch = Stopwatch()..start();
+
+  final nodes = <SendPort>[];
+  for (int i = 0; i < nIsolates; i++) {
+    await Isolate.spawn(
+        ringNode, [done.sendPort, fanOutReplies.sendPort, setup.sendPort]);
+    Expect.isTrue(await setupIterator.moveNext());
+    nodes.add(setupIterator.current as SendPort);
+  }
+  for (int i = 0; i < nIsolates; i++) {
+    nodes[i].send(nodes[(i + 1) % nIsolates]);
+  }
+
+  final spawned = watch.elapsedMicroseconds;
+
+  // One lap is [nIsolates] hops.
+  nodes[0].send(nLaps * nIsolates);
+  Expect.isTrue(await doneIterator.moveNext());
+
+  final ring = watch.elapsedMicroseconds;
+
+  for (int i = 0; i < nFanOuts; i++) {
+    for (final node in nodes) {
+      node.send('ping');
+    }
+    for (int j = 0; j < nIsolates; j++) {
+      Expect.isTrue(await fanOutIterator.moveNext());
+    }
+  }
+
+  final fanOut = watch.elapsedMicroseconds;
+
+  for (final node in nodes) {
+    node.send(null);
+  }
+
+  print('IsolateRing_$nIsolates.Spawn(RunTimeRaw): $spawned us.');
+  print('IsolateRing_$nIsolates.Hop(RunTimeRaw): '
+      '${(ring - spawned) / (nLaps * nIsolates)} us.');
+  print('IsolateRing_$nIsolates.FanOut(RunTimeRaw): '
+      '${(fanOut - ring) / nFanOuts} us.');
+  print('IsolateRing_$nIsolates.DeltaPeak(MemoryUse): ${maxRss - beforeRss}');
+  rssTimer.cancel();
+  await doneIterator.cancel();
+  await fanOutIterator.cancel();
+  await setupIterator.cancel();
+}
@@ -0,0 +1,56 @@
+// Copyright (c) 2022, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+//
+// Measures how fast short lived processes can be started and waited for, as
+// a build tool does. The Heap variants first grow the heap of the parent,
+// which should not change the cost of starting a process.
+
+import 'dart:async';
+import 'dart:io';
+import 'dart:typed_data';
+
+import 'package:benchmark_harness/benchmark_harness.dart';
+
+class ProcessSpawn extends AsyncBenchmarkBase {
+  ProcessSpawn(this.heapMB, this.mode)
+      : super('ProcessSpawn.${mode.toString().split('.').last}'
+            '.Heap${heapMB}MB');
+
+  @override
+  Future<void> setup() async {
+    ballast = Uint8List(heapMB * 1024 * 1024);
+    // Touch every page so that it is part of the resident set.
+    for (int i = 0; i < ballast.length; i += 4096) {
+      ballast[i] = 1;
+    }
+  }
+
+  @override
+  Future<void> run() async {
+    // Keep a few processes running at once, as a build tool would.
+    await Future.wait(<Future<void>>[
+      for (int i = 0; i < 8; i++) spawn(),
+    ]);
+  }
+
+  Future<void> spawn() async {
+    final process = await Process.start('true', const <String>[], mode: mode);
+    if (mode == ProcessStartMode.normal) {
+      await process.stdout.drain<void>();
+      await process.stderr.drain<void>();
+    }
+    if (await process.exitCode != 0) throw 'Bad exit code';
+  }
+
+  final int heapMB;
+  final ProcessStartMode mode;
+  late Uint8List ballast;
+}
+
+Future<void> main() async {
+  for (final heapMB in const <int>[0, 1024]) {
+    await ProcessSpawn(heapMB, ProcessStartMode.normal).report();
+    await ProcessSpawn(heapMB, ProcessStartMode.inheritStdio).report();
+  }
+}
@@ -198,6 +198,87 @@ TreeNode generateBinaryTreeOfDepth(int depth) {
   return gen(depth);
 }
 
+// Each of [isolates] isolates sends [messagesPerRound] small messages, spread
+// evenly over all of them, and waits until it has received as many. Every send
+// looks up the receiving port in the VM's port map from another thread.
+class ManyIsolatesBenchmark {
+  final int isolates;
+  final int messagesPerRound;
+  final List<SendPort> peers = <SendPort>[];
+  ReceivePort replies;
+  StreamIterator repliesIt;
+
+  ManyIsolatesBenchmark(this.isolates, this.messagesPerRound);
+
+  Future report() async {
+    replies = ReceivePort();
+    repliesIt = StreamIterator(replies);
+    for (int i = 0; i < isolates; i++) {
+      await Isolate.spawn(
+          manyIsolatesPeer, [replies.sendPort, isolates, messagesPerRound]);
+      await repliesIt.moveNext();
+      peers.add(repliesIt.current as SendPort);
+    }
+    for (final peer in peers) {
+      peer.send(peers);
+    }
+
+    // Warmup for 200 ms, then run benchmark for 2 seconds.
+    await measureFor(const Duration(milliseconds: 200));
+    final usPerMessage = await measureFor(const Duration(seconds: 2));
+
+    print('SendPort.ManyIsolates.$isolates(RunTimeRaw): $usPerMessage us.');
+
+    for (final peer in peers) {
+      peer.send(null);
+    }
+    await repliesIt.cancel();
+    replies.close();
+  }
+
+  Future<double> measureFor(Duration duration) async {
+    final sw = Stopwatch()..start();
+    int rounds = 0;
+    do {
+      for (final peer in peers) {
+        peer.send(true);
+      }
+      for (int i = 0; i < isolates; i++) {
+        await repliesIt.moveNext();
+      }
+      rounds++;
+    } while (sw.elapsedMicroseconds < duration.inMicroseconds);
+    return sw.elapsedMicroseconds / (rounds * isolates * messagesPerRound);
+  }
+}
+
+void manyIsolatesPeer(List args) {
+  final SendPort done = args[0];
+  final int isolates = args[1];
+  final int messagesPerRound = args[2];
+  final inbox = ReceivePort();
+  List<SendPort> peers;
+  int received = 0;
+  inbox.listen((message) {
+    if (message is int) {
+      if (++received == messagesPerRound) {
+        received = 0;
+        done.send(null);
+      }
+    } else if (message == true) {
+      final allPeers = peers;
+      for (int i = 0; i < messagesPerRound; i++) {
+        allPeers[i % isolates].send(i);
+      }
+    } else if (message is List) {
+      peers = message.cast<SendPort>();
+    } else {
+      inbox.close();
+    }
+  });
+  done.send(inbox.sendPort);
+}
+
 class BenchmarkConfig {
   final String name;
   final dynamic data;
@@ -262,4 +343,8 @@ Future<void> main(args) async {
   for (final config in configs) {
     await SendPortBenchmark(config).report();
   }
+
+  for (final isolates in const <int>[2, 8, 32]) {
+    await ManyIsolatesBenchmark(isolates, 1024).report();
+  }
 }
@@ -0,0 +1,145 @@
+// Copyright (c) 2022, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+//
+// Measures round trips of small messages over many loopback TCP connections
+// served by the same isolate. The cost is dominated by readiness
+// notifications from the event handler and the native read/write calls.
+//
+// The SocketEcho.Isolates variants run the same workload in several isolates
+// at once, which stresses the event handler rather than a single isolate.
+// Compare runs with different --event-handler-threads values.
+
+import 'dart:async';
+import 'dart:io';
+import 'dart:isolate';
+import 'dart:typed_data';
+
+import 'package:benchmark_harness/benchmark_harness.dart';
+
+class EchoClient {
+  EchoClient(this.socket, this.messageSize) {
+    socket.listen((List<int> data) {
+      received += data.length;
+      if (received == messageSize) {
+        received = 0;
+        completer.complete();
+      }
+    });
+  }
+
+  Future<void> roundTrip(Uint8List message) {
+    completer = Completer<void>();
+    socket.add(message);
+    return completer.future;
+  }
+
+  final Socket socket;
+  final int messageSize;
+  int received = 0;
+  late Completer<void> completer;
+}
+
+class SocketEcho extends AsyncBenchmarkBase {
+  SocketEcho(this.connections, this.messageSize)
+      : super('SocketEcho.Connections$connections.Bytes$messageSize');
+
+  @override
+  Future<void> setup() async {
+    message = Uint8List(messageSize);
+    server = await ServerSocket.bind(InternetAddress.loopbackIPv4, 0);
+    server.listen((Socket socket) {
+      socket.setOption(SocketOption.tcpNoDelay, true);
+      socket.listen(socket.add);
+    });
+    for (int i = 0; i < connections; i++) {
+      final socket =
+          await Socket.connect(InternetAddress.loopbackIPv4, server.port);
+      socket.setOption(SocketOption.tcpNoDelay, true);
+      clients.add(EchoClient(socket, messageSize));
+    }
+  }
+
+  @override
+  Future<void> teardown() async {
+    for (final client in clients) {
+      client.socket.destroy();
+    }
+    await server.close();
+  }
+
+  @override
+  Future<void> run() async {
+    await Future.wait(<Future<void>>[
+      for (final client in clients) client.roundTrip(message),
+    ]);
+  }
+
+  final int connections;
+  final int messageSize;
+  final List<EchoClient> clients = <EchoClient>[];
+  late Uint8List message;
+  late ServerSocket server;
+}
+
+Future<void> echoWorker(SendPort replyPort) async {
+  final benchmark = SocketEcho(64, 64);
+  await benchmark.setup();
+  final commands = ReceivePort();
+  replyPort.send(commands.sendPort);
+  await for (final command in commands) {
+    if (command == null) break;
+    await benchmark.run();
+    replyPort.send(true);
+  }
+  await benchmark.teardown();
+  replyPort.send(true);
+}
+
+class SocketEchoIsolates extends AsyncBenchmarkBase {
+  SocketEchoIsolates(this.isolates) : super('SocketEcho.Isolates$isolates');
+
+  @override
+  Future<void> setup() async {
+    for (int i = 0; i < isolates; i++) {
+      final replies = ReceivePort();
+      final inbox = StreamIterator<dynamic>(replies);
+      await Isolate.spawn(echoWorker, replies.sendPort);
+      await inbox.moveNext();
+      outboxes.add(inbox.current as SendPort);
+      inboxes.add(inbox);
+    }
+  }
+
+  @override
+  Future<void> teardown() async {
+    for (final outbox in outboxes) {
+      outbox.send(null);
+    }
+    for (final inbox in inboxes) {
+      await inbox.moveNext();
+      await inbox.cancel();
+    }
+  }
+
+  @override
+  Future<void> run() async {
+    for (final outbox in outboxes) {
+      outbox.send(true);
+    }
+    for (final inbox in inboxes) {
+      await inbox.moveNext();
+    }
+  }
+
+  final int isolates;
+  final List<SendPort> outboxes = <SendPort>[];
+  final List<StreamIterator<dynamic>> inboxes = <StreamIterator<dynamic>>[];
+}
+
+Future<void> main() async {
+  for (final connections in const <int>[1, 64, 512]) {
+    await SocketEcho(connections, 64).report();
+  }
+  await SocketEchoIsolates(8).report();
+}
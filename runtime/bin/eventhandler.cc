@@ -18,6 +18,17 @@ namespace bin {
 static EventHandler* event_handler = NULL;
 static Monitor* shutdown_monitor = NULL;
 
+intptr_t EventHandler::thread_count_ = 1;
+RelaxedAtomic<intptr_t> EventHandler::reuse_port_sockets_ = {0};
+
+intptr_t EventHandler::ThreadForFd(intptr_t fd) {
+  return (fd < 0) ? 0 : fd % thread_count_;
+}
+
+intptr_t EventHandler::ThreadForReusePortSocket() {
+  return reuse_port_sockets_.fetch_add(1) % thread_count_;
+}
+
 void EventHandler::Start() {
   // Initialize global socket registry.
   ListeningSocketRegistry::Initialize();
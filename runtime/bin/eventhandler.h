@@ -9,6 +9,7 @@
 #include "bin/dartutils.h"
 #include "bin/isolate_data.h"
 
+#include "platform/atomic.h"
 #include "platform/hashmap.h"
 #include "platform/priority_queue.h"
 
@@ -629,10 +630,31 @@ class EventHandler {
 
   static void SendFromNative(intptr_t id, Dart_Port port, int64_t data);
 
+  // The number of threads waiting for I/O events. Only the Linux
+  // implementation supports more than one thread, other implementations
+  // ignore this setting. Must be set before the event handler is started.
+  static const intptr_t kMaxThreadCount = 64;
+  static intptr_t thread_count() { return thread_count_; }
+  static void set_thread_count(intptr_t count) {
+    ASSERT((count >= 1) && (count <= kMaxThreadCount));
+    thread_count_ = count;
+  }
+
+  // The index of the thread which handles a socket, chosen when the socket is
+  // created. Sockets are assigned by file descriptor, so that every Socket
+  // for a shared descriptor uses the same epoll instance. Sockets bound with
+  // SO_REUSEPORT are assigned round-robin instead, so that the listeners of
+  // a port map 1:1 to the threads.
+  static intptr_t ThreadForFd(intptr_t fd);
+  static intptr_t ThreadForReusePortSocket();
+
  private:
   friend class EventHandlerImplementation;
   EventHandlerImplementation delegate_;
 
+  static intptr_t thread_count_;
+  static RelaxedAtomic<intptr_t> reuse_port_sockets_;
+
   DISALLOW_COPY_AND_ASSIGN(EventHandler);
 };
 
@@ -70,7 +70,16 @@ static void AddToEpollInstance(intptr_t epoll_fd_, DescriptorInfo* di) {
 }
 
 EventHandlerImplementation::EventHandlerImplementation()
-    : socket_map_(&SimpleHashMap::SamePointerValue, 16) {
+    : EventHandlerImplementation(nullptr) {}
+
+EventHandlerImplementation::EventHandlerImplementation(
+    EventHandlerImplementation* primary)
+    : socket_map_(&SimpleHashMap::SamePointerValue, 16),
+      primary_(primary == nullptr ? this : primary),
+      threads_(nullptr),
+      thread_count_(0),
+      running_threads_(0),
+      handler_(nullptr) {
   intptr_t result;
   result = NO_RETRY_EXPECTED(pipe(interrupt_fds_));
   if (result != 0) {
@@ -118,6 +127,14 @@ EventHandlerImplementation::EventHandlerImplementation()
     FATAL2("Failed adding timerfd fd(%i) to epoll instance: %i", timer_fd_,
            errno);
   }
+  if (primary_ == this) {
+    thread_count_ = EventHandler::thread_count();
+    threads_ = new EventHandlerImplementation*[thread_count_];
+    threads_[0] = this;
+    for (intptr_t i = 1; i < thread_count_; i++) {
+      threads_[i] = new EventHandlerImplementation(this);
+    }
+  }
 }
 
 static void DeleteDescriptorInfo(void* info) {
@@ -127,6 +144,12 @@ static void DeleteDescriptorInfo(void* info) {
 }
 
 EventHandlerImplementation::~EventHandlerImplementation() {
+  if (threads_ != nullptr) {
+    for (intptr_t i = 1; i < thread_count_; i++) {
+      delete threads_[i];
+    }
+    delete[] threads_;
+  }
   socket_map_.Clear(DeleteDescriptorInfo);
   close(epoll_fd_);
   close(timer_fd_);
@@ -386,10 +409,12 @@ void EventHandlerImplementation::HandleEvents(struct epoll_event* events,
 
 void EventHandlerImplementation::Poll(uword args) {
   ThreadSignalBlocker signal_blocker(SIGPROF);
-  static const intptr_t kMaxEvents = 16;
+  // With many active descriptors a larger batch lets a single epoll_wait
+  // return all ready events instead of waking up repeatedly.
+  static const intptr_t kMaxEvents = 256;
   struct epoll_event events[kMaxEvents];
-  EventHandler* handler = reinterpret_cast<EventHandler*>(args);
-  EventHandlerImplementation* handler_impl = &handler->delegate_;
+  EventHandlerImplementation* handler_impl =
+      reinterpret_cast<EventHandlerImplementation*>(args);
   ASSERT(handler_impl != NULL);
 
   while (!handler_impl->shutdown_) {
@@ -404,27 +429,51 @@ void EventHandlerImplementation::Poll(uword args) {
       handler_impl->HandleEvents(events, result);
     }
   }
-  DEBUG_ASSERT(ReferenceCounted<Socket>::instances() == 0);
-  handler->NotifyShutdownDone();
+  // The last thread to exit reports the shutdown. The implementations are
+  // deleted once it is reported, so no other member can be accessed after
+  // the decrement.
+  EventHandlerImplementation* primary = handler_impl->primary_;
+  if (primary->running_threads_.fetch_sub(1) == 1) {
+    DEBUG_ASSERT(ReferenceCounted<Socket>::instances() == 0);
+    primary->handler_->NotifyShutdownDone();
+  }
 }
 
 void EventHandlerImplementation::Start(EventHandler* handler) {
-  int result =
-      Thread::Start("dart:io EventHandler", &EventHandlerImplementation::Poll,
-                    reinterpret_cast<uword>(handler));
-  if (result != 0) {
-    FATAL1("Failed to start event handler thread %d", result);
+  ASSERT(primary_ == this);
+  handler_ = handler;
+  running_threads_.store(thread_count_);
+  for (intptr_t i = 0; i < thread_count_; i++) {
+    int result =
+        Thread::Start("dart:io EventHandler", &EventHandlerImplementation::Poll,
+                      reinterpret_cast<uword>(threads_[i]));
+    if (result != 0) {
+      FATAL1("Failed to start event handler thread %d", result);
+    }
   }
 }
 
 void EventHandlerImplementation::Shutdown() {
-  SendData(kShutdownId, 0, 0);
+  ASSERT(primary_ == this);
+  for (intptr_t i = 0; i < thread_count_; i++) {
+    threads_[i]->WakeupHandler(kShutdownId, 0, 0);
+  }
 }
 
 void EventHandlerImplementation::SendData(intptr_t id,
                                           Dart_Port dart_port,
                                           int64_t data) {
-  WakeupHandler(id, dart_port, data);
+  ASSERT(primary_ == this);
+  if ((id == kTimerId) || (id == kShutdownId)) {
+    WakeupHandler(id, dart_port, data);
+    return;
+  }
+  // The socket's thread was fixed when the socket was created. Its fd must not
+  // be used here: another thread may close the socket concurrently.
+  Socket* socket = reinterpret_cast<Socket*>(id);
+  ASSERT(socket->event_handler_thread() < thread_count_);
+  threads_[socket->event_handler_thread()]->WakeupHandler(id, dart_port,
+                                                          data);
 }
 
 void* EventHandlerImplementation::GetHashmapKeyFromFd(intptr_t fd) {
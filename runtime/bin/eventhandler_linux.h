@@ -14,6 +14,7 @@
 #include <sys/socket.h>
 #include <unistd.h>
 
+#include "platform/atomic.h"
 #include "platform/hashmap.h"
 #include "platform/signal_blocker.h"
 
@@ -58,6 +59,14 @@ class DescriptorInfoMultiple
   DISALLOW_COPY_AND_ASSIGN(DescriptorInfoMultiple);
 };
 
+// Waits for events on a separate thread using epoll.
+//
+// When EventHandler::thread_count() is larger than one, the implementation
+// owned by the EventHandler (the primary) creates additional implementations,
+// each with its own thread and epoll instance. Every socket is pinned to one
+// thread when it is created (see EventHandler::ThreadForFd), so all commands
+// for a socket are handled by the same epoll instance. Timers are always
+// handled by the primary.
 class EventHandlerImplementation {
  public:
   EventHandlerImplementation();
@@ -73,6 +82,8 @@ class EventHandlerImplementation {
   void Shutdown();
 
  private:
+  explicit EventHandlerImplementation(EventHandlerImplementation* primary);
+
   void HandleEvents(struct epoll_event* events, int size);
   static void Poll(uword args);
   void WakeupHandler(intptr_t id, Dart_Port dart_port, int64_t data);
@@ -90,6 +101,16 @@ class EventHandlerImplementation {
   int epoll_fd_;
   int timer_fd_;
 
+  // The implementation owned by the EventHandler. Points to itself for the
+  // primary.
+  EventHandlerImplementation* const primary_;
+  // Only used by the primary: the implementations of all event handler
+  // threads, starting with the primary itself.
+  EventHandlerImplementation** threads_;
+  intptr_t thread_count_;
+  AcqRelAtomic<intptr_t> running_threads_;
+  EventHandler* handler_;
+
   DISALLOW_COPY_AND_ASSIGN(EventHandlerImplementation);
 };
 
@@ -482,6 +482,81 @@ void FUNCTION_NAME(File_Flush)(Dart_NativeArguments args) {
   }
 }
 
+static void MappedMemoryFinalizer(void* isolate_callback_data, void* peer) {
+  delete reinterpret_cast<MappedMemory*>(peer);
+}
+
+// Returns the MappedMemory of an external typed data created by File_Map.
+static MappedMemory* GetMappedMemory(Dart_Handle mapped_list) {
+  void* peer = nullptr;
+  ThrowIfError(Dart_GetPeer(mapped_list, &peer));
+  ASSERT(peer != nullptr);
+  return reinterpret_cast<MappedMemory*>(peer);
+}
+
+void FUNCTION_NAME(File_Map)(Dart_NativeArguments args) {
+  File* file = GetFile(args);
+  ASSERT(file != NULL);
+  // The arguments are checked in Dart code.
+  const int64_t type = DartUtils::GetNativeIntegerArgument(args, 1);
+  const int64_t position = DartUtils::GetNativeIntegerArgument(args, 2);
+  const int64_t length = DartUtils::GetNativeIntegerArgument(args, 3);
+  ASSERT((type == File::kReadOnly) || (type == File::kReadWrite) ||
+         (type == File::kReadWriteShared));
+  ASSERT((position >= 0) && (length > 0));
+  // Map from the preceding aligned position. The Dart code creates a view
+  // skipping the extra bytes at the start.
+  const int64_t aligned_position =
+      Utils::RoundDown(position, File::MapAlignment());
+  MappedMemory* mapping = file->Map(static_cast<File::MapType>(type),
+                                    aligned_position,
+                                    length + (position - aligned_position));
+  if (mapping == nullptr) {
+    Dart_SetReturnValue(args, DartUtils::NewDartOSError());
+    return;
+  }
+  Dart_Handle result = Dart_NewExternalTypedDataWithFinalizer(
+      Dart_TypedData_kUint8, mapping->address(), mapping->size(), mapping,
+      sizeof(*mapping), MappedMemoryFinalizer);
+  if (Dart_IsError(result)) {
+    delete mapping;
+    Dart_PropagateError(result);
+  }
+  ThrowIfError(Dart_SetPeer(result, mapping));
+  Dart_SetReturnValue(args, result);
+}
+
+void FUNCTION_NAME(File_MapAdvise)(Dart_NativeArguments args) {
+  MappedMemory* mapping = GetMappedMemory(Dart_GetNativeArgument(args, 1));
+  const intptr_t offset = DartUtils::GetNativeIntptrArgument(args, 2);
+  const intptr_t length = DartUtils::GetNativeIntptrArgument(args, 3);
+  const int64_t advice = DartUtils::GetNativeIntegerArgument(args, 4);
+  ASSERT((offset >= 0) && (length >= 0) &&
+         ((offset + length) <= mapping->size()));
+  ASSERT((advice >= File::kAdviceNormal) && (advice <= File::kAdviceHugePage));
+  uint8_t* start = reinterpret_cast<uint8_t*>(mapping->address()) + offset;
+  if (File::AdviseMapping(start, length,
+                          static_cast<File::MapAdvice>(advice))) {
+    Dart_SetReturnValue(args, Dart_Null());
+  } else {
+    Dart_SetReturnValue(args, DartUtils::NewDartOSError());
+  }
+}
+
+void FUNCTION_NAME(File_MapSync)(Dart_NativeArguments args) {
+  MappedMemory* mapping = GetMappedMemory(Dart_GetNativeArgument(args, 1));
+  const intptr_t offset = DartUtils::GetNativeIntptrArgument(args, 2);
+  const intptr_t length = DartUtils::GetNativeIntptrArgument(args, 3);
+  ASSERT((offset >= 0) && (length >= 0) &&
+         ((offset + length) <= mapping->size()));
+  uint8_t* start = reinterpret_cast<uint8_t*>(mapping->address()) + offset;
+  if (File::SyncMapping(start, length)) {
+    Dart_SetReturnValue(args, Dart_Null());
+  } else {
+    Dart_SetReturnValue(args, DartUtils::NewDartOSError());
+  }
+}
+
 void FUNCTION_NAME(File_Lock)(Dart_NativeArguments args) {
   File* file = GetFile(args);
   ASSERT(file != NULL);
@@ -1265,6 +1340,63 @@ CObject* File::ReadRequest(const CObjectArray& request) {
   return result;
 }
 
+// Wraps an error that happened after the file was opened in a successful
+// response, so that the caller can tell it apart from failing to open it.
+static CObject* ReadAllError(CObject* error) {
+  CObjectArray* result = new CObjectArray(CObject::NewArray(2));
+  result->SetAt(0, new CObjectIntptr(CObject::NewInt32(0)));
+  result->SetAt(1, error);
+  return result;
+}
+
+// Opens, reads and closes a file in a single request, saving the round trips
+// of separate open, length, read and close requests when reading small
+// files. Returns null if the length of the file is not known up front, e.g.
+// for character devices, in which case the caller reads it in chunks. Errors
+// after the file is opened are returned in place of the data.
+CObject* File::ReadAllRequest(const CObjectArray& request) {
+  if ((request.Length() < 1) || !request[0]->IsIntptr()) {
+    return CObject::IllegalArgumentError();
+  }
+  Namespace* namespc = CObjectToNamespacePointer(request[0]);
+  RefCntReleaseScope<Namespace> rs(namespc);
+  if ((request.Length() != 2) || !request[1]->IsUint8Array()) {
+    return CObject::IllegalArgumentError();
+  }
+  CObjectUint8Array filename(request[1]);
+  File* file = File::Open(
+      namespc, reinterpret_cast<const char*>(filename.Buffer()), File::kRead);
+  if (file == NULL) {
+    return CObject::NewOSError();
+  }
+  RefCntReleaseScope<File> file_scope(file);
+  const int64_t length = file->Length();
+  if (length < 0) {
+    return ReadAllError(CObject::NewOSError());
+  }
+  if (length == 0) {
+    return CObject::Null();
+  }
+  Dart_CObject* io_buffer = CObject::NewIOBuffer(length);
+  if (io_buffer == NULL) {
+    return ReadAllError(CObject::NewOSError());
+  }
+  uint8_t* data = io_buffer->value.as_external_typed_data.data;
+  const int64_t bytes_read = file->Read(data, length);
+  if (bytes_read < 0) {
+    CObject::FreeIOBufferData(io_buffer);
+    return ReadAllError(CObject::NewOSError());
+  }
+  // The file may have been truncated since its length was read.
+  CObject::ShrinkIOBuffer(io_buffer, bytes_read);
+
+  auto external_array = new CObjectExternalUint8Array(io_buffer);
+  CObjectArray* result = new CObjectArray(CObject::NewArray(2));
+  result->SetAt(0, new CObjectIntptr(CObject::NewInt32(0)));
+  result->SetAt(1, external_array);
+  return result;
+}
+
 CObject* File::ReadIntoRequest(const CObjectArray& request) {
   if ((request.Length() < 1) || !request[0]->IsIntptr()) {
     return CObject::IllegalArgumentError();
@@ -115,10 +115,22 @@ class File : public ReferenceCounted<File> {
 
   intptr_t GetFD();
 
+  // These values have to be kept in sync with the map types used by
+  // _RandomAccessFile._mapSync in file_impl.dart.
   enum MapType {
     kReadOnly = 0,
     kReadExecute = 1,
     kReadWrite = 2,
+    kReadWriteShared = 3,
+  };
+
+  // These values have to be kept in sync with MappedFileAdvice in file.dart.
+  enum MapAdvice {
+    kAdviceNormal = 0,
+    kAdviceSequential = 1,
+    kAdviceRandom = 2,
+    kAdviceWillNeed = 3,
+    kAdviceHugePage = 4,
   };
 
   /// Maps or copies the file into memory.
@@ -134,7 +146,8 @@ class File : public ReferenceCounted<File> {
   /// mapping is removed. This mode is not supported on Fuchsia.
   ///
   /// If 'type' is 'kReadWrite', writes to the mapping are *not* copied back to
-  /// the file.
+  /// the file. If 'type' is 'kReadWriteShared', they are, which is not
+  /// supported on Fuchsia and Windows.
   ///
   /// 'position' + 'length' may be larger than the file size. In this case, the
   /// extra memory is zero-filled.
@@ -143,6 +156,17 @@ class File : public ReferenceCounted<File> {
                     int64_t length,
                     void* start = nullptr);
 
+  // The alignment required for the 'position' passed to Map.
+  static intptr_t MapAlignment();
+
+  // Hints the expected access pattern for the pages of a mapping in
+  // [address, address + length). Returns true if the hint is not supported.
+  static bool AdviseMapping(void* address, intptr_t length, MapAdvice advice);
+
+  // Writes the modified pages of a 'kReadWriteShared' mapping in
+  // [address, address + length) back to the file.
+  static bool SyncMapping(void* address, intptr_t length);
+
   // Read/Write attempt to transfer num_bytes to/from buffer. It returns
   // the number of bytes read/written.
   int64_t Read(void* buffer, int64_t num_bytes);
@@ -317,6 +341,7 @@ class File : public ReferenceCounted<File> {
   static CObject* WriteByteRequest(const CObjectArray& request);
   static CObject* ReadRequest(const CObjectArray& request);
   static CObject* ReadIntoRequest(const CObjectArray& request);
+  static CObject* ReadAllRequest(const CObjectArray& request);
   static CObject* WriteFromRequest(const CObjectArray& request);
   static CObject* CreateLinkRequest(const CObjectArray& request);
   static CObject* DeleteLinkRequest(const CObjectArray& request);
@@ -97,6 +97,10 @@ MappedMemory* File::Map(MapType type,
     case kReadWrite:
       prot = PROT_READ | PROT_WRITE;
       break;
+    case kReadWriteShared:
+      prot = PROT_READ | PROT_WRITE;
+      flags = MAP_SHARED;
+      break;
   }
   if (start != nullptr) {
     hint = start;
@@ -116,6 +120,54 @@ void MappedMemory::Unmap() {
   size_ = 0;
 }
 
+intptr_t File::MapAlignment() {
+  return getpagesize();
+}
+
+bool File::AdviseMapping(void* address, intptr_t length, MapAdvice advice) {
+  int native_advice = MADV_NORMAL;
+  switch (advice) {
+    case kAdviceNormal:
+      native_advice = MADV_NORMAL;
+      break;
+    case kAdviceSequential:
+      native_advice = MADV_SEQUENTIAL;
+      break;
+    case kAdviceRandom:
+      native_advice = MADV_RANDOM;
+      break;
+    case kAdviceWillNeed:
+      native_advice = MADV_WILLNEED;
+      break;
+    case kAdviceHugePage:
+#if defined(MADV_HUGEPAGE)
+      native_advice = MADV_HUGEPAGE;
+      break;
+#else
+      return true;
+#endif
+  }
+  const uword page_size = getpagesize();
+  const uword start =
+      Utils::RoundDown(reinterpret_cast<uword>(address), page_size);
+  const uword end = reinterpret_cast<uword>(address) + length;
+  if (madvise(reinterpret_cast<void*>(start), end - start, native_advice) ==
+      0) {
+    return true;
+  }
+  // Huge pages may not be enabled, or not available for file mappings.
+  return (advice == kAdviceHugePage) && (errno == EINVAL);
+}
+
+bool File::SyncMapping(void* address, intptr_t length) {
+  const uword page_size = getpagesize();
+  const uword start =
+      Utils::RoundDown(reinterpret_cast<uword>(address), page_size);
+  const uword end = reinterpret_cast<uword>(address) + length;
+  return NO_RETRY_EXPECTED(msync(reinterpret_cast<void*>(start), end - start,
+                                 MS_SYNC)) == 0;
+}
+
 int64_t File::Read(void* buffer, int64_t num_bytes) {
   ASSERT(handle_->fd() >= 0);
   return TEMP_FAILURE_RETRY(read(handle_->fd(), buffer, num_bytes));
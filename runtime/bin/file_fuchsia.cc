@@ -99,6 +99,10 @@ MappedMemory* File::Map(MapType type,
     case kReadWrite:
       prot = PROT_READ | PROT_WRITE;
       break;
+    case kReadWriteShared:
+      // Writing back to the file is not supported.
+      errno = ENOTSUP;
+      return nullptr;
   }
   if (start != nullptr) {
     hint = start;
@@ -118,6 +122,20 @@ void MappedMemory::Unmap() {
   size_ = 0;
 }
 
+intptr_t File::MapAlignment() {
+  return getpagesize();
+}
+
+bool File::AdviseMapping(void* address, intptr_t length, MapAdvice advice) {
+  // Access pattern hints are not supported.
+  return true;
+}
+
+bool File::SyncMapping(void* address, intptr_t length) {
+  // Only private mappings are supported, which are never written back.
+  return true;
+}
+
 int64_t File::Read(void* buffer, int64_t num_bytes) {
   ASSERT(handle_->fd() >= 0);
   return NO_RETRY_EXPECTED(read(handle_->fd(), buffer, num_bytes));
@@ -98,6 +98,10 @@ MappedMemory* File::Map(File::MapType type,
       prot_alloc = PAGE_READWRITE;
       prot_final = PAGE_READWRITE;
       break;
+    case File::kReadWriteShared:
+      // Mappings are copies of the file, writing back is not supported.
+      SetLastError(ERROR_NOT_SUPPORTED);
+      return nullptr;
   }
 
   void* addr = start;
@@ -145,6 +149,21 @@ void MappedMemory::Unmap() {
   size_ = 0;
 }
 
+intptr_t File::MapAlignment() {
+  // Mappings are copies of the file, any position can be used.
+  return 1;
+}
+
+bool File::AdviseMapping(void* address, intptr_t length, MapAdvice advice) {
+  // Mappings are copies of the file already in memory.
+  return true;
+}
+
+bool File::SyncMapping(void* address, intptr_t length) {
+  // Mappings are copies of the file, which are never written back.
+  return true;
+}
+
 int64_t File::Read(void* buffer, int64_t num_bytes) {
   ASSERT(handle_->fd() >= 0);
   return Utils::Read(handle_->fd(), buffer, num_bytes);
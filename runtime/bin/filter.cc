@@ -17,6 +17,17 @@ const int kZLibFlagAcceptAnyHeader = 32;
 
 static const int kFilterPointerNativeField = 0;
 
+// Initial output capacity of Filter_ProcessAll, which doubles as needed.
+static const intptr_t kMinProcessAllSize = 4 * KB;
+// Filter_ProcessAll copies its input into the filter this many bytes at a
+// time, so that the typed data is only acquired for the copy.
+static const intptr_t kProcessAllChunkSize = 64 * KB;
+
+static void ThrowAllocationFailure() {
+  OSError os_error(-1, "Failed to allocate buffer", OSError::kUnknown);
+  Dart_ThrowException(DartUtils::NewDartOSError(&os_error));
+}
+
 static Dart_Handle GetFilter(Dart_Handle filter_obj, Filter** filter) {
   ASSERT(filter != NULL);
   Filter* result;
@@ -182,6 +193,16 @@ void FUNCTION_NAME(Filter_Process)(Dart_NativeArguments args) {
   if (Dart_IsError(err)) {
     Dart_PropagateError(err);
   }
+  // The input buffer is still referenced by the stream until all of the
+  // previous chunk has been processed, so it must not be reused before that.
+  if (filter->processing()) {
+    Dart_ThrowException(DartUtils::NewInternalError(
+        "Call to Process while still processing data"));
+  }
+  uint8_t* input_buffer = filter->input_buffer(chunk_length);
+  if (input_buffer == NULL) {
+    ThrowAllocationFailure();
+  }
 
   Dart_Handle result = Dart_TypedDataAcquireData(
       data_obj, &type, reinterpret_cast<void**>(&buffer), &length);
@@ -192,36 +213,31 @@ void FUNCTION_NAME(Filter_Process)(Dart_NativeArguments args) {
       Dart_ThrowException(DartUtils::NewInternalError(
           "Invalid argument passed to Filter_Process"));
     }
-    uint8_t* zlib_buffer = new uint8_t[chunk_length];
-    if (zlib_buffer == NULL) {
-      Dart_TypedDataReleaseData(data_obj);
-      Dart_PropagateError(Dart_NewApiError("Could not allocate zlib buffer"));
-    }
-
-    memmove(zlib_buffer, buffer + start, chunk_length);
+    memmove(input_buffer, buffer + start, chunk_length);
     Dart_TypedDataReleaseData(data_obj);
-    buffer = zlib_buffer;
   } else {
     err = Dart_ListLength(data_obj, &length);
     if (Dart_IsError(err)) {
       Dart_PropagateError(err);
     }
-    buffer = new uint8_t[chunk_length];
-    if (buffer == NULL) {
-      Dart_PropagateError(Dart_NewApiError("Could not allocate buffer"));
-    }
-    err = Dart_ListGetAsBytes(data_obj, start, buffer, chunk_length);
+    err = Dart_ListGetAsBytes(data_obj, start, input_buffer, chunk_length);
     if (Dart_IsError(err)) {
-      delete[] buffer;
       Dart_PropagateError(err);
     }
   }
-  // Process will take ownership of buffer, if successful.
-  if (!filter->Process(buffer, chunk_length)) {
-    delete[] buffer;
-    Dart_ThrowException(DartUtils::NewInternalError(
-        "Call to Process while still processing data"));
+  bool processing = filter->Process(input_buffer, chunk_length);
+  ASSERT(processing);
+}
+
+static Dart_Handle NewExternalBuffer(uint8_t* buffer, intptr_t length) {
+  Dart_Handle result =
+      Dart_NewExternalTypedDataWithFinalizer(Dart_TypedData_kUint8, buffer,
+                                             length, buffer, length,
+                                             IOBuffer::Finalizer);
+  if (Dart_IsError(result)) {
+    IOBuffer::Free(buffer);
   }
+  return result;
 }
 
 void FUNCTION_NAME(Filter_Processed)(Dart_NativeArguments args) {
@@ -237,25 +253,134 @@ void FUNCTION_NAME(Filter_Processed)(Dart_NativeArguments args) {
     Dart_PropagateError(err);
   }
 
+  uint8_t* processed_buffer = filter->processed_buffer();
+  if (processed_buffer == NULL) {
+    ThrowAllocationFailure();
+  }
   intptr_t read = filter->Processed(
-      filter->processed_buffer(), filter->processed_buffer_size(), flush, end);
+      processed_buffer, filter->processed_buffer_size(), flush, end);
   if (read < 0) {
     Dart_ThrowException(
         DartUtils::NewDartFormatException("Filter error, bad data"));
   } else if (read == 0) {
+    // The chunk has been consumed, and with it the end of the stream if
+    // requested.
+    if (end) {
+      filter->ReleaseBuffers();
+    } else {
+      filter->ShrinkInputBuffer();
+    }
     Dart_SetReturnValue(args, Dart_Null());
   } else {
     uint8_t* io_buffer;
     Dart_Handle result = IOBuffer::Allocate(read, &io_buffer);
     if (Dart_IsNull(result)) {
-      Dart_SetReturnValue(args, DartUtils::NewDartOSError());
-      return;
+      ThrowAllocationFailure();
     }
-    memmove(io_buffer, filter->processed_buffer(), read);
+    memmove(io_buffer, processed_buffer, read);
     Dart_SetReturnValue(args, result);
   }
 }
 
+// Runs the whole of data through the filter as the last input of the stream
+// and returns all of the output in a single Uint8List, so that converting a
+// complete buffer takes one native call instead of one per 64KB of output.
+void FUNCTION_NAME(Filter_ProcessAll)(Dart_NativeArguments args) {
+  Dart_Handle filter_obj = Dart_GetNativeArgument(args, 0);
+  Dart_Handle data_obj = Dart_GetNativeArgument(args, 1);
+  intptr_t start = DartUtils::GetIntptrValue(Dart_GetNativeArgument(args, 2));
+  intptr_t end = DartUtils::GetIntptrValue(Dart_GetNativeArgument(args, 3));
+
+  Filter* filter = NULL;
+  Dart_Handle err = GetFilter(filter_obj, &filter);
+  if (Dart_IsError(err)) {
+    Dart_PropagateError(err);
+  }
+  if (filter->processing()) {
+    Dart_ThrowException(DartUtils::NewInternalError(
+        "Call to Process while still processing data"));
+  }
+
+  intptr_t capacity = Utils::Maximum(end - start, kMinProcessAllSize);
+  uint8_t* output = IOBuffer::Allocate(capacity);
+  if (output == NULL) {
+    ThrowAllocationFailure();
+  }
+
+  intptr_t used = 0;
+  intptr_t position = start;
+  bool error = false;
+  bool out_of_memory = false;
+  do {
+    const intptr_t chunk_length =
+        Utils::Minimum(end - position, kProcessAllChunkSize);
+    const bool last = (position + chunk_length) == end;
+    uint8_t* input_buffer = filter->input_buffer(chunk_length);
+    if (input_buffer == NULL) {
+      out_of_memory = true;
+      break;
+    }
+    Dart_TypedData_Type type;
+    uint8_t* buffer = NULL;
+    intptr_t length;
+    err = Dart_TypedDataAcquireData(data_obj, &type,
+                                    reinterpret_cast<void**>(&buffer), &length);
+    if (Dart_IsError(err)) {
+      IOBuffer::Free(output);
+      Dart_PropagateError(err);
+    }
+    if (type != Dart_TypedData_kUint8 && type != Dart_TypedData_kInt8) {
+      Dart_TypedDataReleaseData(data_obj);
+      IOBuffer::Free(output);
+      Dart_ThrowException(DartUtils::NewInternalError(
+          "Invalid argument passed to Filter_ProcessAll"));
+    }
+    memmove(input_buffer, buffer + position, chunk_length);
+    Dart_TypedDataReleaseData(data_obj);
+    position += chunk_length;
+
+    bool processing = filter->Process(input_buffer, chunk_length);
+    ASSERT(processing);
+    while (true) {
+      if (used == capacity) {
+        uint8_t* grown = IOBuffer::Reallocate(output, capacity * 2);
+        if (grown == NULL) {
+          // Processing into an empty buffer ends processing of the chunk.
+          filter->Processed(output, 0, false, last);
+          out_of_memory = true;
+          break;
+        }
+        output = grown;
+        capacity *= 2;
+      }
+      intptr_t read =
+          filter->Processed(output + used, capacity - used, false, last);
+      if (read <= 0) {
+        error = read < 0;
+        break;
+      }
+      used += read;
+    }
+    ASSERT(!filter->processing());
+  } while (!error && !out_of_memory && (position < end));
+  filter->ReleaseBuffers();
+
+  if (error) {
+    IOBuffer::Free(output);
+    Dart_ThrowException(
+        DartUtils::NewDartFormatException("Filter error, bad data"));
+  } else if (out_of_memory) {
+    IOBuffer::Free(output);
+    ThrowAllocationFailure();
+  }
+  output = IOBuffer::Reallocate(output, used);
+  Dart_Handle result = NewExternalBuffer(output, used);
+  if (Dart_IsError(result)) {
+    Dart_PropagateError(result);
+  }
+  Dart_SetReturnValue(args, result);
+}
+
 static void DeleteFilter(void* isolate_data, void* filter_pointer) {
   Filter* filter = reinterpret_cast<Filter*>(filter_pointer);
   delete filter;
@@ -270,11 +395,53 @@ Dart_Handle Filter::SetFilterAndCreateFinalizer(Dart_Handle filter,
   if (Dart_IsError(err)) {
     return err;
   }
+  // Also count the input and output buffers, which are allocated while the
+  // filter is in use.
   Dart_NewFinalizableHandle(filter, reinterpret_cast<void*>(filter_pointer),
-                            size, DeleteFilter);
+                            size + 2 * kFilterBufferSize, DeleteFilter);
   return err;
 }
 
+Filter::~Filter() {
+  ReleaseBuffers();
+}
+
+uint8_t* Filter::input_buffer(intptr_t length) {
+  if ((input_buffer_ == NULL) || (length > input_buffer_size_)) {
+    free(input_buffer_);
+    input_buffer_size_ = Utils::Maximum(length, kFilterBufferSize);
+    input_buffer_ = reinterpret_cast<uint8_t*>(malloc(input_buffer_size_));
+    if (input_buffer_ == NULL) {
+      input_buffer_size_ = 0;
+    }
+  }
+  return input_buffer_;
+}
+
+void Filter::ShrinkInputBuffer() {
+  ASSERT(!processing());
+  if (input_buffer_size_ > kFilterBufferSize) {
+    free(input_buffer_);
+    input_buffer_ = NULL;
+    input_buffer_size_ = 0;
+  }
+}
+
+uint8_t* Filter::processed_buffer() {
+  if (processed_buffer_ == NULL) {
+    processed_buffer_ = reinterpret_cast<uint8_t*>(malloc(kFilterBufferSize));
+  }
+  return processed_buffer_;
+}
+
+void Filter::ReleaseBuffers() {
+  free(input_buffer_);
+  input_buffer_ = NULL;
+  input_buffer_size_ = 0;
+  free(processed_buffer_);
+  processed_buffer_ = NULL;
+}
+
 Dart_Handle Filter::GetFilterNativeField(Dart_Handle filter,
                                          Filter** filter_pointer) {
   return Dart_GetNativeInstanceField(
@@ -284,7 +451,6 @@ Dart_Handle Filter::GetFilterNativeField(Dart_Handle filter,
 
 ZLibDeflateFilter::~ZLibDeflateFilter() {
   delete[] dictionary_;
-  delete[] current_buffer_;
   if (initialized()) {
     deflateEnd(&stream_);
   }
@@ -361,7 +527,6 @@ intptr_t ZLibDeflateFilter::Processed(uint8_t* buffer,
       error = true;
   }
 
-  delete[] current_buffer_;
   current_buffer_ = NULL;
   // Either 0 Byte processed or error
   return error ? -1 : 0;
@@ -369,7 +534,6 @@ intptr_t ZLibDeflateFilter::Processed(uint8_t* buffer,
 
 ZLibInflateFilter::~ZLibInflateFilter() {
   delete[] dictionary_;
-  delete[] current_buffer_;
   if (initialized()) {
     inflateEnd(&stream_);
   }
@@ -444,7 +608,6 @@ intptr_t ZLibInflateFilter::Processed(uint8_t* buffer,
       error = true;
   }
 
-  delete[] current_buffer_;
   current_buffer_ = NULL;
   // Either 0 Byte processed or error
   return error ? -1 : 0;
@@ -15,20 +15,21 @@ namespace bin {
 
 class Filter {
  public:
-  virtual ~Filter() {}
+  virtual ~Filter();
 
   virtual bool Init() = 0;
 
   /**
-   * On a successful call to Process, Process will take ownership of data. On
-   * successive calls to either Processed or ~Filter, data will be freed with
-   * a delete[] call.
+   * Process does not take ownership of data, but data must stay valid until
+   * Processed returns 0 or a negative value. Filter_Process copies its input
+   * into the filter's input_buffer, which is reused for successive chunks.
    */
   virtual bool Process(uint8_t* data, intptr_t length) = 0;
   virtual intptr_t Processed(uint8_t* buffer,
                              intptr_t length,
                              bool finish,
                              bool end) = 0;
+  virtual bool processing() const = 0;
 
   static Dart_Handle SetFilterAndCreateFinalizer(Dart_Handle filter,
                                                  Filter* filter_pointer,
@@ -38,16 +39,36 @@ class Filter {
 
   bool initialized() const { return initialized_; }
   void set_initialized(bool value) { initialized_ = value; }
-  uint8_t* processed_buffer() { return processed_buffer_; }
+
+  // Returns a buffer of at least length bytes owned by the filter, or NULL if
+  // it cannot be allocated. Buffers of up to kFilterBufferSize bytes are
+  // reused by the following chunks, larger ones are freed by
+  // ShrinkInputBuffer once the chunk has been processed.
+  uint8_t* input_buffer(intptr_t length);
+  void ShrinkInputBuffer();
+
+  // The output buffer is allocated lazily and reused by every call to
+  // Processed. Returns NULL if it cannot be allocated.
+  uint8_t* processed_buffer();
   intptr_t processed_buffer_size() const { return kFilterBufferSize; }
 
+  // Frees the input and output buffers, e.g. at the end of the stream. They
+  // are allocated again if the filter is used after that.
+  void ReleaseBuffers();
+
  protected:
-  Filter() : initialized_(false) {}
+  Filter()
+      : initialized_(false),
+        input_buffer_(NULL),
+        input_buffer_size_(0),
+        processed_buffer_(NULL) {}
 
  private:
   static const intptr_t kFilterBufferSize = 64 * KB;
-  uint8_t processed_buffer_[kFilterBufferSize];
   bool initialized_;
+  uint8_t* input_buffer_;
+  intptr_t input_buffer_size_;
+  uint8_t* processed_buffer_;
 
   DISALLOW_COPY_AND_ASSIGN(Filter);
 };
@@ -79,6 +100,7 @@ class ZLibDeflateFilter : public Filter {
                              intptr_t length,
                              bool finish,
                              bool end);
+  virtual bool processing() const { return current_buffer_ != NULL; }
 
  private:
   const bool gzip_;
@@ -114,6 +136,7 @@ class ZLibInflateFilter : public Filter {
                              intptr_t length,
                              bool finish,
                              bool end);
+  virtual bool processing() const { return current_buffer_ != NULL; }
 
  private:
   const int32_t window_bits_;
@@ -54,6 +54,9 @@ namespace bin {
   V(File_LengthFromPath, 2)                                                    \
   V(File_LinkTarget, 2)                                                        \
   V(File_Lock, 4)                                                              \
+  V(File_Map, 4)                                                               \
+  V(File_MapAdvise, 5)                                                         \
+  V(File_MapSync, 4)                                                           \
   V(File_Open, 3)                                                              \
   V(File_OpenStdio, 1)                                                         \
   V(File_Position, 1)                                                          \
@@ -81,6 +84,7 @@ namespace bin {
   V(Filter_CreateZLibDeflate, 8)                                               \
   V(Filter_CreateZLibInflate, 4)                                               \
   V(Filter_Process, 4)                                                         \
+  V(Filter_ProcessAll, 4)                                                      \
   V(Filter_Processed, 3)                                                       \
   V(ResourceHandleImpl_toFile, 1)                                              \
   V(ResourceHandleImpl_toSocket, 1)                                            \
@@ -150,6 +154,7 @@ namespace bin {
   V(Socket_CreateBindDatagram, 6)                                              \
   V(Socket_CreateConnect, 4)                                                   \
   V(Socket_CreateUnixDomainConnect, 3)                                         \
+  V(Socket_DuplicateFd, 1)                                                     \
   V(Socket_GetPort, 1)                                                         \
   V(Socket_GetRemotePeer, 1)                                                   \
   V(Socket_GetError, 1)                                                        \
@@ -162,8 +167,9 @@ namespace bin {
   V(Socket_GetType, 1)                                                         \
   V(Socket_JoinMulticast, 4)                                                   \
   V(Socket_LeaveMulticast, 4)                                                  \
-  V(Socket_Read, 2)                                                            \
+  V(Socket_ReadInto, 4)                                                        \
   V(Socket_RecvFrom, 1)                                                        \
+  V(Socket_RecvFromBatch, 5)                                                   \
   V(Socket_ReceiveMessage, 2)                                                  \
   V(Socket_SendMessage, 5)                                                     \
   V(Socket_SendTo, 6)                                                          \
@@ -171,6 +177,7 @@ namespace bin {
   V(Socket_SetRawOption, 4)                                                    \
   V(Socket_SetSocketId, 3)                                                     \
   V(Socket_WriteList, 4)                                                       \
+  V(Socket_WriteVector, 4)                                                     \
   V(SocketControlMessage_fromHandles, 2)                                       \
   V(SocketControlMessageImpl_extractHandles, 1)                                \
   V(Stdin_ReadByte, 1)                                                         \
@@ -10,6 +10,7 @@
 
 #include "bin/dartdev_isolate.h"
 #include "bin/error_exit.h"
+#include "bin/eventhandler.h"
 #include "bin/file_system_watcher.h"
 #include "bin/options.h"
 #include "bin/platform.h"
@@ -86,6 +87,18 @@ DFE* Options::dfe_ = NULL;
 DEFINE_STRING_OPTION_CB(dfe, { Options::dfe()->set_frontend_filename(value); });
 #endif  // !defined(DART_PRECOMPILED_RUNTIME)
 
+DEFINE_STRING_OPTION_CB(event_handler_threads, {
+  char* end;
+  const intptr_t count = strtol(value, &end, 10);
+  if ((*end != '\0') || (count < 1) ||
+      (count > EventHandler::kMaxThreadCount)) {
+    Syslog::PrintErr("Invalid value for option event_handler_threads: '%s'\n",
+                     value);
+    return false;
+  }
+  EventHandler::set_thread_count(count);
+});
+
 static void hot_reload_test_mode_callback(CommandLineOptions* vm_options) {
   // Identity reload.
   vm_options->AddArgument("--identity_reload");
@@ -242,6 +255,12 @@ void Options::PrintUsage() {
 "  The path to a directory that dart:io calls will treat as the root of the\n"
 "  filesystem.\n"
 #endif  // defined(DART_HOST_OS_LINUX) || defined(DART_HOST_OS_ANDROID)
+#if defined(DART_HOST_OS_LINUX)
+"--event-handler-threads=<count>\n"
+"  The number of threads waiting for I/O events (default 1, at most 64).\n"
+"  Sockets are distributed between the threads by file descriptor, sockets\n"
+"  bound with reusePort round-robin.\n"
+#endif  // defined(DART_HOST_OS_LINUX)
 "\n"
 "The following options are only used for VM development and may\n"
 "be changed in any future version:\n");
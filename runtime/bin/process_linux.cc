@@ -10,6 +10,7 @@
 #include <errno.h>         // NOLINT
 #include <fcntl.h>         // NOLINT
 #include <poll.h>          // NOLINT
+#include <signal.h>        // NOLINT
 #include <stdio.h>         // NOLINT
 #include <stdlib.h>        // NOLINT
 #include <string.h>        // NOLINT
@@ -22,6 +23,7 @@
 #include "bin/fdutils.h"
 #include "bin/file.h"
 #include "bin/lockers.h"
+#include "bin/namespace.h"
 #include "bin/reference_counting.h"
 #include "bin/thread.h"
 #include "platform/syslog.h"
@@ -73,11 +75,20 @@ class ProcessInfoList {
 
   static void AddProcess(pid_t pid, intptr_t fd) {
     MutexLocker locker(mutex_);
+    AddProcessLocked(pid, fd);
+  }
+
+  // Callers holding mutex() across starting a process and registering it
+  // make the exit code handler wait for the registration, even if the
+  // process has already exited.
+  static void AddProcessLocked(pid_t pid, intptr_t fd) {
     ProcessInfo* info = new ProcessInfo(pid, fd);
     info->set_next(active_processes_);
     active_processes_ = info;
   }
 
+  static Mutex* mutex() { return mutex_; }
+
   static intptr_t LookupProcessExitFd(pid_t pid) {
     MutexLocker locker(mutex_);
     ProcessInfo* current = active_processes_;
@@ -275,7 +286,9 @@ class ProcessStarter {
         err_(err),
         id_(id),
         exit_event_(exit_event),
-        os_error_message_(os_error_message) {
+        os_error_message_(os_error_message),
+        use_vfork_(false),
+        vfork_errno_(0) {
     read_in_[0] = -1;
     read_in_[1] = -1;
     read_err_[0] = -1;
@@ -305,12 +318,68 @@ class ProcessStarter {
   }
 
   int Start() {
+    use_vfork_ = CanStartWithVFork();
+
     // Create pipes required.
     int err = CreatePipes();
     if (err != 0) {
       return err;
     }
 
+    pid_t pid;
+    if (use_vfork_) {
+      err = StartWithVFork(&pid);
+    } else {
+      err = StartWithFork(&pid);
+    }
+
+    // Return error code if any failures.
+    if (err != 0) {
+      if (Process::ModeIsAttached(mode_)) {
+        // Since exec() failed, we're not interested in the exit code.
+        // We close the reading side of the exit code pipe here.
+        // GetProcessExitCodes will get a broken pipe error when it
+        // tries to write to the writing side of the pipe and it will
+        // ignore the error.
+        close(*exit_event_);
+        *exit_event_ = -1;
+      }
+      CloseAllPipes();
+      return err;
+    }
+
+    if (Process::ModeHasStdio(mode_)) {
+      // Connect stdio, stdout and stderr.
+      FDUtils::SetNonBlocking(read_in_[0]);
+      *in_ = read_in_[0];
+      close(read_in_[1]);
+      FDUtils::SetNonBlocking(write_out_[1]);
+      *out_ = write_out_[1];
+      close(write_out_[0]);
+      FDUtils::SetNonBlocking(read_err_[0]);
+      *err_ = read_err_[0];
+      close(read_err_[1]);
+    } else {
+      // Close all fds.
+      close(read_in_[0]);
+      close(read_in_[1]);
+      ASSERT(write_out_[0] == -1);
+      ASSERT(write_out_[1] == -1);
+      ASSERT(read_err_[0] == -1);
+      ASSERT(read_err_[1] == -1);
+    }
+    ASSERT(exec_control_[0] == -1);
+    ASSERT(exec_control_[1] == -1);
+
+    *id_ = pid;
+    return 0;
+  }
+
+ private:
+  static constexpr int kErrorBufferSize = 1024;
+
+  int StartWithFork(pid_t* pid_result) {
+    int err = 0;
     // Fork to create the new process.
     pid_t pid = TEMP_FAILURE_RETRY(fork());
     if (pid < 0) {
@@ -354,57 +423,116 @@ class ProcessStarter {
     }
     close(exec_control_[0]);
     exec_control_[0] = -1;
+    *pid_result = pid;
+    return err;
+  }
 
-    // Return error code if any failures.
-    if (err != 0) {
-      if (Process::ModeIsAttached(mode_)) {
-        // Since exec() failed, we're not interested in the exit code.
-        // We close the reading side of the exit code pipe here.
-        // GetProcessExitCodes will get a broken pipe error when it
-        // tries to write to the writing side of the pipe and it will
-        // ignore the error.
-        close(*exit_event_);
-        *exit_event_ = -1;
-      }
-      CloseAllPipes();
-      return err;
+  // vfork does not copy the page tables of the parent, so unlike fork its
+  // cost does not grow with the size of the heap. The child borrows the
+  // parent's memory and stack until it calls exec, so it may only make
+  // system calls. That rules out detached processes, which fork twice, and
+  // non-default namespaces, whose working directory lives in the parent.
+  bool CanStartWithVFork() {
+    if (!Process::ModeIsAttached(mode_) || !Namespace::IsDefault(namespc_)) {
+      return false;
     }
+    // execvpe searches the PATH of the parent rather than the one in the new
+    // environment, so that case needs the environment to be set first.
+    return (program_environment_ == NULL) || (strchr(path_, '/') != NULL);
+  }
 
-    if (Process::ModeHasStdio(mode_)) {
-      // Connect stdio, stdout and stderr.
-      FDUtils::SetNonBlocking(read_in_[0]);
-      *in_ = read_in_[0];
-      close(read_in_[1]);
-      FDUtils::SetNonBlocking(write_out_[1]);
-      *out_ = write_out_[1];
-      close(write_out_[0]);
-      FDUtils::SetNonBlocking(read_err_[0]);
-      *err_ = read_err_[0];
-      close(read_err_[1]);
-    } else {
-      // Close all fds.
-      close(read_in_[0]);
-      close(read_in_[1]);
-      ASSERT(write_out_[0] == -1);
-      ASSERT(write_out_[1] == -1);
-      ASSERT(read_err_[0] == -1);
-      ASSERT(read_err_[1] == -1);
+  int StartWithVFork(pid_t* pid_result) {
+    int event_fds[2];
+    if (TEMP_FAILURE_RETRY(pipe2(event_fds, O_CLOEXEC)) < 0) {
+      return CleanupAndReturnError();
     }
-    ASSERT(exec_control_[0] == -1);
-    ASSERT(exec_control_[1] == -1);
 
-    *id_ = pid;
+    // Signal handlers must not run in the child while it shares the memory
+    // of the parent. The child resets them before restoring the mask.
+    sigset_t all_signals;
+    sigset_t old_signals;
+    sigfillset(&all_signals);
+    pthread_sigmask(SIG_SETMASK, &all_signals, &old_signals);
+
+    pid_t pid;
+    {
+      MutexLocker locker(ProcessInfoList::mutex());
+      pid = vfork();
+      if (pid == 0) {
+        ExecVForkedProcess(&old_signals);
+      }
+      if (pid > 0) {
+        ExitCodeHandler::ProcessStarted();
+        ProcessInfoList::AddProcessLocked(pid, event_fds[1]);
+      }
+    }
+    int saved_errno = errno;
+    pthread_sigmask(SIG_SETMASK, &old_signals, NULL);
+
+    if (pid < 0) {
+      close(event_fds[0]);
+      close(event_fds[1]);
+      errno = saved_errno;
+      return CleanupAndReturnError();
+    }
+    *exit_event_ = event_fds[0];
+    FDUtils::SetNonBlocking(event_fds[0]);
+    *pid_result = pid;
+
+    // The parent only resumes once the child has called exec or exited, so
+    // vfork_errno_ is final here.
+    if (vfork_errno_ != 0) {
+      errno = vfork_errno_;
+      SetChildOsErrorMessage();
+      return vfork_errno_;
+    }
     return 0;
   }
 
- private:
-  static constexpr int kErrorBufferSize = 1024;
+  void ExecVForkedProcess(const sigset_t* signal_mask) {
+    struct sigaction default_action;
+    memset(&default_action, 0, sizeof(default_action));
+    default_action.sa_handler = SIG_DFL;
+    for (int signal = 1; signal < NSIG; signal++) {
+      struct sigaction action;
+      if ((sigaction(signal, NULL, &action) == 0) &&
+          (action.sa_handler != SIG_IGN) && (action.sa_handler != SIG_DFL)) {
+        sigaction(signal, &default_action, NULL);
+      }
+    }
+    pthread_sigmask(SIG_SETMASK, signal_mask, NULL);
+
+    if (mode_ == kNormal) {
+      if ((TEMP_FAILURE_RETRY(dup2(write_out_[0], STDIN_FILENO)) == -1) ||
+          (TEMP_FAILURE_RETRY(dup2(read_in_[1], STDOUT_FILENO)) == -1) ||
+          (TEMP_FAILURE_RETRY(dup2(read_err_[1], STDERR_FILENO)) == -1)) {
+        ReportVForkedChildError();
+      }
+    } else {
+      ASSERT(mode_ == kInheritStdio);
+    }
+    if ((working_directory_ != NULL) &&
+        (NO_RETRY_EXPECTED(chdir(working_directory_)) != 0)) {
+      ReportVForkedChildError();
+    }
+    execvpe(path_, const_cast<char* const*>(program_arguments_),
+            (program_environment_ != NULL) ? program_environment_ : environ);
+    ReportVForkedChildError();
+  }
+
+  void ReportVForkedChildError() {
+    vfork_errno_ = errno;
+    _exit(1);
+  }
 
   int CreatePipes() {
     int result;
-    result = TEMP_FAILURE_RETRY(pipe2(exec_control_, O_CLOEXEC));
-    if (result < 0) {
-      return CleanupAndReturnError();
+    // A vforked child reports exec failures through vfork_errno_.
+    if (!use_vfork_) {
+      result = TEMP_FAILURE_RETRY(pipe2(exec_control_, O_CLOEXEC));
+      if (result < 0) {
+        return CleanupAndReturnError();
+      }
     }
 
     // For a detached process the pipe to connect stdout is still used for
@@ -789,6 +917,9 @@ class ProcessStarter {
   intptr_t* id_;
   intptr_t* exit_event_;
   char** os_error_message_;
+  bool use_vfork_;
+  // Written by a vforked child, which shares the memory of this process.
+  volatile int vfork_errno_;
 
   DISALLOW_ALLOCATION();
   DISALLOW_IMPLICIT_CONSTRUCTORS(ProcessStarter);
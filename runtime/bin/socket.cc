@@ -507,8 +507,13 @@ void FUNCTION_NAME(Socket_CreateBindDatagram)(Dart_NativeArguments args) {
   intptr_t socket =
       Socket::CreateBindDatagram(addr, reuse_addr, reuse_port, ttl);
   if (socket >= 0) {
-    Socket::SetSocketIdNativeField(Dart_GetNativeArgument(args, 0), socket,
-                                   Socket::kFinalizerNormal);
+    Socket* socketfd = new Socket(socket);
+    if (reuse_port) {
+      socketfd->set_event_handler_thread(
+          EventHandler::ThreadForReusePortSocket());
+    }
+    Socket::ReuseSocketIdNativeField(Dart_GetNativeArgument(args, 0),
+                                     socketfd, Socket::kFinalizerNormal);
     Dart_SetReturnValue(args, Dart_True());
   } else {
     OSError error;
@@ -529,51 +534,43 @@ void FUNCTION_NAME(Socket_Available)(Dart_NativeArguments args) {
   }
 }
 
-void FUNCTION_NAME(Socket_Read)(Dart_NativeArguments args) {
+void FUNCTION_NAME(Socket_ReadInto)(Dart_NativeArguments args) {
   Socket* socket =
       Socket::GetSocketIdNativeField(Dart_GetNativeArgument(args, 0));
-  int64_t length = 0;
-  if (DartUtils::GetInt64Value(Dart_GetNativeArgument(args, 1), &length) &&
-      (length >= 0)) {
-    if (Socket::short_socket_read()) {
-      length = (length + 1) / 2;
-    }
-    uint8_t* buffer = nullptr;
-    Dart_Handle result = IOBuffer::Allocate(length, &buffer);
-    if (Dart_IsNull(result)) {
-      Dart_ThrowException(DartUtils::NewDartOSError());
-    }
-    if (Dart_IsError(result)) {
-      Dart_PropagateError(result);
-    }
-    ASSERT(buffer != nullptr);
-    intptr_t bytes_read =
-        SocketBase::Read(socket->fd(), buffer, length, SocketBase::kAsync);
-    if (bytes_read == length) {
-      Dart_SetReturnValue(args, result);
-    } else if (bytes_read > 0) {
-      uint8_t* new_buffer = nullptr;
-      Dart_Handle new_result = IOBuffer::Allocate(bytes_read, &new_buffer);
-      if (Dart_IsNull(new_result)) {
-        Dart_ThrowException(DartUtils::NewDartOSError());
-      }
-      if (Dart_IsError(new_result)) {
-        Dart_PropagateError(new_result);
-      }
-      ASSERT(new_buffer != nullptr);
-      memmove(new_buffer, buffer, bytes_read);
-      Dart_SetReturnValue(args, new_result);
-    } else if (bytes_read == 0) {
-      // On MacOS when reading from a tty Ctrl-D will result in reading one
-      // less byte then reported as available.
-      Dart_SetReturnValue(args, Dart_Null());
-    } else {
-      ASSERT(bytes_read == -1);
-      Dart_ThrowException(DartUtils::NewDartOSError());
-    }
+  Dart_Handle buffer_obj = Dart_GetNativeArgument(args, 1);
+  ASSERT(Dart_IsTypedData(buffer_obj));
+  intptr_t offset = DartUtils::GetIntptrValue(Dart_GetNativeArgument(args, 2));
+  intptr_t length = DartUtils::GetIntptrValue(Dart_GetNativeArgument(args, 3));
+  if (Socket::short_socket_read()) {
+    length = (length + 1) / 2;
+  }
+  // Read directly into the caller's buffer instead of allocating an external
+  // typed data for every read.
+  Dart_TypedData_Type type;
+  uint8_t* buffer = nullptr;
+  intptr_t len;
+  Dart_Handle result = Dart_TypedDataAcquireData(
+      buffer_obj, &type, reinterpret_cast<void**>(&buffer), &len);
+  if (Dart_IsError(result)) {
+    Dart_PropagateError(result);
+  }
+  ASSERT(type == Dart_TypedData_kUint8);
+  ASSERT((offset >= 0) && (length >= 0) && ((offset + length) <= len));
+  buffer += offset;
+  intptr_t bytes_read =
+      SocketBase::Read(socket->fd(), buffer, length, SocketBase::kAsync);
+  if (bytes_read >= 0) {
+    Dart_TypedDataReleaseData(buffer_obj);
+    Dart_SetIntegerReturnValue(args, bytes_read);
   } else {
-    OSError os_error(-1, "Invalid argument", OSError::kUnknown);
-    Dart_ThrowException(DartUtils::NewDartOSError(&os_error));
+    // Extract OSError before we release data, as it may override the error.
+    Dart_Handle error;
+    {
+      OSError os_error;
+      Dart_TypedDataReleaseData(buffer_obj);
+      error = DartUtils::NewDartOSError(&os_error);
+    }
+    Dart_ThrowException(error);
   }
 }
 
@@ -660,6 +657,100 @@ void FUNCTION_NAME(Socket_RecvFrom)(Dart_NativeArguments args) {
   Dart_SetReturnValue(args, result);
 }
 
+// Number of int64 entries describing each datagram in the info list passed
+// to Socket_RecvFromBatch: length, port and address type.
+static constexpr intptr_t kDatagramInfoLength = 3;
+// Size of the slot for the sender address of each datagram.
+static constexpr intptr_t kDatagramAddressLength = sizeof(struct in6_addr);
+
+void FUNCTION_NAME(Socket_RecvFromBatch)(Dart_NativeArguments args) {
+  Socket* socket =
+      Socket::GetSocketIdNativeField(Dart_GetNativeArgument(args, 0));
+  Dart_Handle buffer_obj = Dart_GetNativeArgument(args, 1);
+  intptr_t slot_size =
+      DartUtils::GetIntptrValue(Dart_GetNativeArgument(args, 2));
+  Dart_Handle info_obj = Dart_GetNativeArgument(args, 3);
+  Dart_Handle addresses_obj = Dart_GetNativeArgument(args, 4);
+  ASSERT(slot_size > 0);
+
+  Dart_TypedData_Type type;
+  uint8_t* buffer = nullptr;
+  intptr_t buffer_len;
+  Dart_Handle result = Dart_TypedDataAcquireData(
+      buffer_obj, &type, reinterpret_cast<void**>(&buffer), &buffer_len);
+  if (Dart_IsError(result)) {
+    Dart_PropagateError(result);
+  }
+  ASSERT(type == Dart_TypedData_kUint8);
+  intptr_t count =
+      Utils::Minimum(buffer_len / slot_size, SocketBase::kMaxRecvDatagrams);
+  ASSERT(count > 0);
+
+  // Receive directly into the shared buffer, one slot per datagram.
+  intptr_t lengths[SocketBase::kMaxRecvDatagrams];
+  RawAddr addrs[SocketBase::kMaxRecvDatagrams];
+  intptr_t received = SocketBase::RecvFromBatch(
+      socket->fd(), buffer, slot_size, count, lengths, addrs,
+      SocketBase::kAsync);
+  if (received < 0) {
+    // Extract OSError before we release data, as it may override the error.
+    Dart_Handle error;
+    {
+      OSError os_error;
+      Dart_TypedDataReleaseData(buffer_obj);
+      error = DartUtils::NewDartOSError(&os_error);
+    }
+    Dart_ThrowException(error);
+  }
+  Dart_TypedDataReleaseData(buffer_obj);
+  if (received == 0) {
+    Dart_SetIntegerReturnValue(args, 0);
+    return;
+  }
+
+  int64_t* info = nullptr;
+  intptr_t info_len;
+  result = Dart_TypedDataAcquireData(info_obj, &type,
+                                     reinterpret_cast<void**>(&info), &info_len);
+  if (Dart_IsError(result)) {
+    Dart_PropagateError(result);
+  }
+  ASSERT(type == Dart_TypedData_kInt64);
+  ASSERT(info_len >= received * kDatagramInfoLength);
+  uint8_t* addresses = nullptr;
+  intptr_t addresses_len;
+  result = Dart_TypedDataAcquireData(addresses_obj, &type,
+                                     reinterpret_cast<void**>(&addresses),
+                                     &addresses_len);
+  if (Dart_IsError(result)) {
+    Dart_TypedDataReleaseData(info_obj);
+    Dart_PropagateError(result);
+  }
+  ASSERT(type == Dart_TypedData_kUint8);
+  ASSERT(addresses_len >= received * kDatagramAddressLength);
+  for (intptr_t i = 0; i < received; i++) {
+    // TODO(21403): Add checks for AF_UNIX, if unix domain sockets
+    // are used in SOCK_DGRAM.
+    const RawAddr& addr = addrs[i];
+    const void* in_addr;
+    if (addr.addr.sa_family == AF_INET) {
+      in_addr = &addr.in.sin_addr;
+    } else {
+      ASSERT(addr.addr.sa_family == AF_INET6);
+      in_addr = &addr.in6.sin6_addr;
+    }
+    memmove(addresses + i * kDatagramAddressLength, in_addr,
+            SocketAddress::GetInAddrLength(addr));
+    int64_t* datagram_info = info + i * kDatagramInfoLength;
+    datagram_info[0] = lengths[i];
+    datagram_info[1] = SocketAddress::GetAddrPort(addr);
+    datagram_info[2] = (addr.addr.sa_family == AF_INET) ? 0 : 1;
+  }
+  Dart_TypedDataReleaseData(addresses_obj);
+  Dart_TypedDataReleaseData(info_obj);
+  Dart_SetIntegerReturnValue(args, received);
+}
+
 void FUNCTION_NAME(Socket_ReceiveMessage)(Dart_NativeArguments args) {
   Socket* socket = Socket::GetSocketIdNativeField(
       ThrowIfError(Dart_GetNativeArgument(args, 0)));
@@ -766,6 +857,112 @@ void FUNCTION_NAME(Socket_WriteList)(Dart_NativeArguments args) {
   }
 }
 
+static void ReleaseWriteVectorData(const Dart_Handle* handles,
+                                   const intptr_t* first,
+                                   intptr_t count) {
+  for (intptr_t i = 0; i < count; i++) {
+    if (first[i] == i) {
+      Dart_TypedDataReleaseData(handles[i]);
+    }
+  }
+}
+
+void FUNCTION_NAME(Socket_WriteVector)(Dart_NativeArguments args) {
+  Socket* socket =
+      Socket::GetSocketIdNativeField(Dart_GetNativeArgument(args, 0));
+  Dart_Handle buffers_obj = Dart_GetNativeArgument(args, 1);
+  Dart_Handle offsets_obj = Dart_GetNativeArgument(args, 2);
+  Dart_Handle lengths_obj = Dart_GetNativeArgument(args, 3);
+  intptr_t count = 0;
+  Dart_Handle result = Dart_ListLength(buffers_obj, &count);
+  if (Dart_IsError(result)) {
+    Dart_PropagateError(result);
+  }
+  ASSERT((count > 0) && (count <= SocketBase::kMaxWriteVBuffers));
+  Dart_Handle handles[SocketBase::kMaxWriteVBuffers];
+  intptr_t offsets[SocketBase::kMaxWriteVBuffers];
+  intptr_t lengths[SocketBase::kMaxWriteVBuffers];
+  // Index of the first occurrence of the same buffer, as the data of an
+  // object can only be acquired once.
+  intptr_t first[SocketBase::kMaxWriteVBuffers];
+  // Read all the arguments before acquiring any data, as the Dart API cannot
+  // be used while data is acquired.
+  for (intptr_t i = 0; i < count; i++) {
+    handles[i] = Dart_ListGetAt(buffers_obj, i);
+    if (Dart_IsError(handles[i])) {
+      Dart_PropagateError(handles[i]);
+    }
+    ASSERT(Dart_IsTypedData(handles[i]));
+    offsets[i] = DartUtils::GetIntptrValue(Dart_ListGetAt(offsets_obj, i));
+    lengths[i] = DartUtils::GetIntptrValue(Dart_ListGetAt(lengths_obj, i));
+    first[i] = i;
+    for (intptr_t j = 0; j < i; j++) {
+      if (Dart_IdentityEquals(handles[i], handles[j])) {
+        first[i] = j;
+        break;
+      }
+    }
+  }
+  bool short_write = false;
+  if (Socket::short_socket_write()) {
+    if ((count > 1) || (lengths[0] > 1)) {
+      short_write = true;
+    }
+    count = 1;
+    lengths[0] = (lengths[0] + 1) / 2;
+  }
+  uint8_t* data[SocketBase::kMaxWriteVBuffers];
+  const void* buffers[SocketBase::kMaxWriteVBuffers];
+  for (intptr_t i = 0; i < count; i++) {
+    if (first[i] == i) {
+      Dart_TypedData_Type type;
+      intptr_t len;
+      result = Dart_TypedDataAcquireData(
+          handles[i], &type, reinterpret_cast<void**>(&data[i]), &len);
+      if (Dart_IsError(result)) {
+        ReleaseWriteVectorData(handles, first, i);
+        Dart_PropagateError(result);
+      }
+      ASSERT((offsets[i] + lengths[i]) <= len);
+    } else {
+      data[i] = data[first[i]];
+    }
+    buffers[i] = data[i] + offsets[i];
+  }
+  intptr_t bytes_written =
+      SocketBase::WriteV(socket->fd(), buffers, lengths, count,
+                         SocketBase::kAsync);
+  if (bytes_written >= 0) {
+    ReleaseWriteVectorData(handles, first, count);
+    if (short_write) {
+      // If the write was forced 'short', indicate by returning the negative
+      // number of bytes. A forced short write may not trigger a write event.
+      Dart_SetIntegerReturnValue(args, -bytes_written);
+    } else {
+      Dart_SetIntegerReturnValue(args, bytes_written);
+    }
+  } else {
+    // Extract OSError before we release data, as it may override the error.
+    Dart_Handle error;
+    {
+      OSError os_error;
+      ReleaseWriteVectorData(handles, first, count);
+      error = DartUtils::NewDartOSError(&os_error);
+    }
+    Dart_ThrowException(error);
+  }
+}
+
+void FUNCTION_NAME(Socket_DuplicateFd)(Dart_NativeArguments args) {
+  Socket* socket =
+      Socket::GetSocketIdNativeField(Dart_GetNativeArgument(args, 0));
+  intptr_t fd = SocketBase::Duplicate(socket->fd());
+  if (fd < 0) {
+    Dart_ThrowException(DartUtils::NewDartOSError());
+  }
+  Dart_SetIntegerReturnValue(args, fd);
+}
+
 void FUNCTION_NAME(Socket_SendMessage)(Dart_NativeArguments args) {
   Socket* socket =
       Socket::GetSocketIdNativeField(Dart_GetNativeArgument(args, 0));
@@ -1164,6 +1361,56 @@ CObject* Socket::ListInterfacesRequest(const CObjectArray& request) {
   return CObject::IllegalArgumentError();
 }
 
+static int64_t CObjectInt32OrInt64ToInt64(CObject* cobject) {
+  ASSERT(cobject->IsInt32OrInt64());
+  if (cobject->IsInt32()) {
+    CObjectInt32 value(cobject);
+    return value.Value();
+  }
+  CObjectInt64 value(cobject);
+  return value.Value();
+}
+
+// Sends a region of a file to a socket, so that reading the file does not
+// block the isolate. The socket descriptor is a duplicate made by
+// Socket_DuplicateFd, which is closed here. Returns the number of bytes
+// sent, 0 if the socket is not writable, or -1 if the file ends at the
+// offset.
+CObject* Socket::SendFileRequest(const CObjectArray& request) {
+  if ((request.Length() != 4) || !request[0]->IsIntptr() ||
+      !request[1]->IsIntptr() || !request[2]->IsInt32OrInt64() ||
+      !request[3]->IsInt32OrInt64()) {
+    return CObject::IllegalArgumentError();
+  }
+  const intptr_t fd = CObjectIntptr(request[0]).Value();
+  File* file = reinterpret_cast<File*>(CObjectIntptr(request[1]).Value());
+  const int64_t offset = CObjectInt32OrInt64ToInt64(request[2]);
+  const intptr_t count = static_cast<intptr_t>(Utils::Minimum<int64_t>(
+      CObjectInt32OrInt64ToInt64(request[3]), kMaxInt32));
+  CObject* result;
+  if ((file == nullptr) || file->IsClosed()) {
+    result = CObject::FileClosedError();
+  } else if ((offset < 0) || (count <= 0)) {
+    result = CObject::IllegalArgumentError();
+  } else {
+    const intptr_t written =
+        SocketBase::SendFile(fd, file->GetFD(), offset, count,
+                             SocketBase::kAsync);
+    if (written == SocketBase::kEndOfFile) {
+      result = new CObjectInt64(CObject::NewInt64(-1));
+    } else if (written < 0) {
+      result = CObject::NewOSError();
+    } else {
+      result = new CObjectInt64(CObject::NewInt64(written));
+    }
+  }
+  if (file != nullptr) {
+    file->Release();
+  }
+  SocketBase::Close(fd);
+  return result;
+}
+
 void FUNCTION_NAME(Socket_GetOption)(Dart_NativeArguments args) {
   Socket* socket =
       Socket::GetSocketIdNativeField(Dart_GetNativeArgument(args, 0));
@@ -51,6 +51,14 @@ class Socket : public ReferenceCounted<Socket> {
 
   intptr_t fd() const { return fd_; }
 
+  // The event handler thread handling this socket, see
+  // EventHandler::ThreadForFd. Fixed when the socket is set up, so it can be
+  // read without synchronization even while another thread closes the fd.
+  intptr_t event_handler_thread() const { return event_handler_thread_; }
+  void set_event_handler_thread(intptr_t thread) {
+    event_handler_thread_ = thread;
+  }
+
   // Close fd and may need to decrement the count of handle by calling
   // release().
   void CloseFd();
@@ -88,6 +96,7 @@ class Socket : public ReferenceCounted<Socket> {
   static CObject* LookupRequest(const CObjectArray& request);
   static CObject* ListInterfacesRequest(const CObjectArray& request);
   static CObject* ReverseLookupRequest(const CObjectArray& request);
+  static CObject* SendFileRequest(const CObjectArray& request);
 
   static Dart_Port GetServicePort();
 
@@ -128,6 +137,7 @@ class Socket : public ReferenceCounted<Socket> {
   Dart_Port isolate_port_;
   Dart_Port port_;
   uint8_t* udp_receive_buffer_;
+  intptr_t event_handler_thread_ = 0;
 
   friend class ReferenceCounted<Socket>;
   DISALLOW_COPY_AND_ASSIGN(Socket);
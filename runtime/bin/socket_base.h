@@ -198,6 +198,27 @@ class SocketBase : public AllStatic {
                         const void* buffer,
                         intptr_t num_bytes,
                         SocketOpKind sync);
+  // Writes the buffers in order, using a single system call where the
+  // platform supports vectored writes. At most kMaxWriteVBuffers buffers can
+  // be written at once. Returns the total number of bytes written, which can
+  // end in the middle of any of the buffers.
+  static constexpr intptr_t kMaxWriteVBuffers = 64;
+  static intptr_t WriteV(intptr_t fd,
+                         const void* const* buffers,
+                         const intptr_t* lengths,
+                         intptr_t count,
+                         SocketOpKind sync);
+  // Writes up to num_bytes bytes of the file with descriptor file_fd,
+  // starting at offset, to the socket without copying them through user
+  // space where the platform supports it. Returns the number of bytes
+  // written, 0 if an asynchronous write would block, kEndOfFile if offset is
+  // at or past the end of the file, or -1 on error.
+  static constexpr intptr_t kEndOfFile = -2;
+  static intptr_t SendFile(intptr_t fd,
+                           intptr_t file_fd,
+                           int64_t offset,
+                           intptr_t num_bytes,
+                           SocketOpKind sync);
   // Send data on a socket. The port to send to is specified in the port
   // component of the passed RawAddr structure. The RawAddr structure is only
   // used for datagram sockets.
@@ -218,6 +239,18 @@ class SocketBase : public AllStatic {
                            intptr_t num_bytes,
                            RawAddr* addr,
                            SocketOpKind sync);
+  // Receives up to count datagrams into consecutive slots of slot_size
+  // bytes in buffer, using a single system call where the platform supports
+  // it. Datagrams larger than slot_size are truncated. Returns the number of
+  // datagrams received and stores their lengths and senders.
+  static constexpr intptr_t kMaxRecvDatagrams = 64;
+  static intptr_t RecvFromBatch(intptr_t fd,
+                                uint8_t* buffer,
+                                intptr_t slot_size,
+                                intptr_t count,
+                                intptr_t* lengths,
+                                RawAddr* addrs,
+                                SocketOpKind sync);
   static intptr_t ReceiveMessage(intptr_t fd,
                                  void* buffer,
                                  int64_t* p_buffer_num_bytes,
@@ -234,6 +267,9 @@ class SocketBase : public AllStatic {
   static void GetError(intptr_t fd, OSError* os_error);
   static int GetType(intptr_t fd);
   static intptr_t GetStdioHandle(intptr_t num);
+  // Returns a new descriptor for the socket fd, which the caller closes with
+  // Close, or -1 if that fails or the platform does not support it.
+  static intptr_t Duplicate(intptr_t fd);
   static void Close(intptr_t fd);
   static bool GetNoDelay(intptr_t fd, bool* enabled);
   static bool SetNoDelay(intptr_t fd, bool enabled);
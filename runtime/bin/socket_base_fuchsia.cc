@@ -124,6 +124,18 @@ intptr_t SocketBase::RecvFrom(intptr_t fd,
   return -1;
 }
 
+intptr_t SocketBase::RecvFromBatch(intptr_t fd,
+                                   uint8_t* buffer,
+                                   intptr_t slot_size,
+                                   intptr_t count,
+                                   intptr_t* lengths,
+                                   RawAddr* addrs,
+                                   SocketOpKind sync) {
+  ASSERT((count > 0) && (count <= kMaxRecvDatagrams));
+  errno = ENOSYS;
+  return -1;
+}
+
 bool SocketControlMessage::is_file_descriptors_control_message() {
   return false;
 }
@@ -168,6 +180,49 @@ intptr_t SocketBase::Write(intptr_t fd,
   return written_bytes;
 }
 
+intptr_t SocketBase::WriteV(intptr_t fd,
+                            const void* const* buffers,
+                            const intptr_t* lengths,
+                            intptr_t count,
+                            SocketOpKind sync) {
+  ASSERT((count > 0) && (count <= kMaxWriteVBuffers));
+  // No vectored write support, write the buffers one at a time and stop at
+  // the first short write.
+  intptr_t total = 0;
+  for (intptr_t i = 0; i < count; i++) {
+    intptr_t written_bytes = Write(fd, buffers[i], lengths[i], sync);
+    if (written_bytes < 0) {
+      return (total > 0) ? total : written_bytes;
+    }
+    total += written_bytes;
+    if (written_bytes < lengths[i]) {
+      break;
+    }
+  }
+  return total;
+}
+
+intptr_t SocketBase::SendFile(intptr_t fd,
+                              intptr_t file_fd,
+                              int64_t offset,
+                              intptr_t num_bytes,
+                              SocketOpKind sync) {
+  ASSERT(num_bytes > 0);
+  // There is no sendfile, copy one buffer at a time. Bytes that are read but
+  // not written are read again by the next call.
+  const intptr_t kBufferSize = 16 * KB;
+  uint8_t buffer[kBufferSize];
+  ssize_t read_bytes = TEMP_FAILURE_RETRY(
+      pread(file_fd, buffer, Utils::Minimum(num_bytes, kBufferSize), offset));
+  if (read_bytes < 0) {
+    return -1;
+  }
+  if (read_bytes == 0) {
+    return kEndOfFile;
+  }
+  return Write(fd, buffer, read_bytes, sync);
+}
+
 intptr_t SocketBase::SendTo(intptr_t fd,
                             const void* buffer,
                             intptr_t num_bytes,
@@ -376,6 +431,12 @@ AddressList<InterfaceSocketAddress>* SocketBase::ListInterfaces(
   return addresses;
 }
 
+intptr_t SocketBase::Duplicate(intptr_t fd) {
+  // Sockets are IOHandles owned by the event handler.
+  errno = ENOSYS;
+  return -1;
+}
+
 void SocketBase::Close(intptr_t fd) {
   IOHandle* handle = reinterpret_cast<IOHandle*>(fd);
   ASSERT(handle->fd() >= 0);
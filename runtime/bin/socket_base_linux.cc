@@ -14,7 +14,9 @@
 #include <stdio.h>        // NOLINT
 #include <stdlib.h>       // NOLINT
 #include <string.h>       // NOLINT
+#include <sys/sendfile.h>  // NOLINT
 #include <sys/stat.h>     // NOLINT
+#include <sys/uio.h>      // NOLINT
 #include <unistd.h>       // NOLINT
 
 #include "bin/fdutils.h"
@@ -99,6 +101,38 @@ intptr_t SocketBase::RecvFrom(intptr_t fd,
   return read_bytes;
 }
 
+intptr_t SocketBase::RecvFromBatch(intptr_t fd,
+                                   uint8_t* buffer,
+                                   intptr_t slot_size,
+                                   intptr_t count,
+                                   intptr_t* lengths,
+                                   RawAddr* addrs,
+                                   SocketOpKind sync) {
+  ASSERT(fd >= 0);
+  ASSERT((count > 0) && (count <= kMaxRecvDatagrams));
+  struct mmsghdr messages[kMaxRecvDatagrams];
+  struct iovec iov[kMaxRecvDatagrams];
+  memset(messages, 0, sizeof(struct mmsghdr) * count);
+  for (intptr_t i = 0; i < count; i++) {
+    iov[i].iov_base = buffer + i * slot_size;
+    iov[i].iov_len = slot_size;
+    messages[i].msg_hdr.msg_iov = &iov[i];
+    messages[i].msg_hdr.msg_iovlen = 1;
+    messages[i].msg_hdr.msg_name = &addrs[i].addr;
+    messages[i].msg_hdr.msg_namelen = sizeof(addrs[i].ss);
+  }
+  int received = TEMP_FAILURE_RETRY(recvmmsg(fd, messages, count, 0, nullptr));
+  if ((sync == kAsync) && (received == -1) && (errno == EWOULDBLOCK)) {
+    // If the read would block we need to retry and therefore return 0
+    // as the number of datagrams received.
+    received = 0;
+  }
+  for (intptr_t i = 0; i < received; i++) {
+    lengths[i] = messages[i].msg_len;
+  }
+  return received;
+}
+
 bool SocketControlMessage::is_file_descriptors_control_message() {
   return level_ == SOL_SOCKET && type_ == SCM_RIGHTS;
 }
@@ -192,6 +226,51 @@ intptr_t SocketBase::Write(intptr_t fd,
   return written_bytes;
 }
 
+intptr_t SocketBase::WriteV(intptr_t fd,
+                            const void* const* buffers,
+                            const intptr_t* lengths,
+                            intptr_t count,
+                            SocketOpKind sync) {
+  ASSERT(fd >= 0);
+  ASSERT((count > 0) && (count <= kMaxWriteVBuffers));
+  struct iovec iov[kMaxWriteVBuffers];
+  for (intptr_t i = 0; i < count; i++) {
+    iov[i].iov_base = const_cast<void*>(buffers[i]);
+    iov[i].iov_len = lengths[i];
+  }
+  ssize_t written_bytes = TEMP_FAILURE_RETRY(writev(fd, iov, count));
+  ASSERT(EAGAIN == EWOULDBLOCK);
+  if ((sync == kAsync) && (written_bytes == -1) && (errno == EWOULDBLOCK)) {
+    // If the would block we need to retry and therefore return 0 as
+    // the number of bytes written.
+    written_bytes = 0;
+  }
+  return written_bytes;
+}
+
+intptr_t SocketBase::SendFile(intptr_t fd,
+                              intptr_t file_fd,
+                              int64_t offset,
+                              intptr_t num_bytes,
+                              SocketOpKind sync) {
+  ASSERT(fd >= 0);
+  ASSERT(num_bytes > 0);
+  off64_t file_offset = offset;
+  ssize_t written_bytes = TEMP_FAILURE_RETRY(
+      sendfile64(fd, file_fd, &file_offset, num_bytes));
+  if (written_bytes == 0) {
+    // Nothing was sent although num_bytes > 0, the file ends at offset.
+    return kEndOfFile;
+  }
+  ASSERT(EAGAIN == EWOULDBLOCK);
+  if ((sync == kAsync) && (written_bytes == -1) && (errno == EWOULDBLOCK)) {
+    // If the would block we need to retry and therefore return 0 as
+    // the number of bytes written.
+    written_bytes = 0;
+  }
+  return written_bytes;
+}
+
 intptr_t SocketBase::SendTo(intptr_t fd,
                             const void* buffer,
                             intptr_t num_bytes,
@@ -481,6 +560,16 @@ AddressList<InterfaceSocketAddress>* SocketBase::ListInterfaces(
   return addresses;
 }
 
+intptr_t SocketBase::Duplicate(intptr_t fd) {
+  ASSERT(fd >= 0);
+  intptr_t result = NO_RETRY_EXPECTED(dup(fd));
+  if ((result >= 0) && !FDUtils::SetCloseOnExec(result)) {
+    FDUtils::SaveErrorAndClose(result);
+    return -1;
+  }
+  return result;
+}
+
 void SocketBase::Close(intptr_t fd) {
   ASSERT(fd >= 0);
   close(fd);
@@ -14,7 +14,9 @@
 #include <stdio.h>        // NOLINT
 #include <stdlib.h>       // NOLINT
 #include <string.h>       // NOLINT
+#include <sys/socket.h>   // NOLINT
 #include <sys/stat.h>     // NOLINT
+#include <sys/uio.h>      // NOLINT
 #include <unistd.h>       // NOLINT
 
 #include "bin/fdutils.h"
@@ -98,6 +100,34 @@ intptr_t SocketBase::RecvFrom(intptr_t fd,
   return read_bytes;
 }
 
+intptr_t SocketBase::RecvFromBatch(intptr_t fd,
+                                   uint8_t* buffer,
+                                   intptr_t slot_size,
+                                   intptr_t count,
+                                   intptr_t* lengths,
+                                   RawAddr* addrs,
+                                   SocketOpKind sync) {
+  ASSERT((count > 0) && (count <= kMaxRecvDatagrams));
+  ASSERT(fd >= 0);
+  // No batched receive, read one datagram at a time until none are left.
+  // Datagrams can be empty, so only a read that would block ends the batch.
+  intptr_t received = 0;
+  while (received < count) {
+    socklen_t addr_len = sizeof(addrs[received].ss);
+    ssize_t read_bytes = TEMP_FAILURE_RETRY(
+        recvfrom(fd, buffer + received * slot_size, slot_size, 0,
+                 &addrs[received].addr, &addr_len));
+    if (read_bytes == -1) {
+      if ((sync == kAsync) && (errno == EWOULDBLOCK)) {
+        break;
+      }
+      return (received > 0) ? received : -1;
+    }
+    lengths[received++] = read_bytes;
+  }
+  return received;
+}
+
 bool SocketControlMessage::is_file_descriptors_control_message() {
   return false;
 }
@@ -136,6 +166,51 @@ intptr_t SocketBase::Write(intptr_t fd,
   return written_bytes;
 }
 
+intptr_t SocketBase::WriteV(intptr_t fd,
+                            const void* const* buffers,
+                            const intptr_t* lengths,
+                            intptr_t count,
+                            SocketOpKind sync) {
+  ASSERT(fd >= 0);
+  ASSERT((count > 0) && (count <= kMaxWriteVBuffers));
+  struct iovec iov[kMaxWriteVBuffers];
+  for (intptr_t i = 0; i < count; i++) {
+    iov[i].iov_base = const_cast<void*>(buffers[i]);
+    iov[i].iov_len = lengths[i];
+  }
+  ssize_t written_bytes = TEMP_FAILURE_RETRY(writev(fd, iov, count));
+  ASSERT(EAGAIN == EWOULDBLOCK);
+  if ((sync == kAsync) && (written_bytes == -1) && (errno == EWOULDBLOCK)) {
+    // If the would block we need to retry and therefore return 0 as
+    // the number of bytes written.
+    written_bytes = 0;
+  }
+  return written_bytes;
+}
+
+intptr_t SocketBase::SendFile(intptr_t fd,
+                              intptr_t file_fd,
+                              int64_t offset,
+                              intptr_t num_bytes,
+                              SocketOpKind sync) {
+  ASSERT(fd >= 0);
+  ASSERT(num_bytes > 0);
+  // On input len is the number of bytes to send, on output the number of
+  // bytes sent, also when the call fails with EAGAIN after a partial write.
+  off_t len = num_bytes;
+  int result = sendfile(file_fd, fd, offset, &len, nullptr, 0);
+  if (result == 0) {
+    // A successful call that sent nothing means the file ends at offset.
+    return (len == 0) ? kEndOfFile : len;
+  }
+  ASSERT(EAGAIN == EWOULDBLOCK);
+  if (((errno == EWOULDBLOCK) || (errno == EINTR)) &&
+      ((len > 0) || (sync == kAsync))) {
+    return len;
+  }
+  return -1;
+}
+
 intptr_t SocketBase::SendTo(intptr_t fd,
                             const void* buffer,
                             intptr_t num_bytes,
@@ -366,6 +441,16 @@ AddressList<InterfaceSocketAddress>* SocketBase::ListInterfaces(
   return addresses;
 }
 
+intptr_t SocketBase::Duplicate(intptr_t fd) {
+  ASSERT(fd >= 0);
+  intptr_t result = NO_RETRY_EXPECTED(dup(fd));
+  if ((result >= 0) && !FDUtils::SetCloseOnExec(result)) {
+    FDUtils::SaveErrorAndClose(result);
+    return -1;
+  }
+  return result;
+}
+
 void SocketBase::Close(intptr_t fd) {
   ASSERT(fd >= 0);
   close(fd);
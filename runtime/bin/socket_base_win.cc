@@ -7,6 +7,8 @@
 
 #include "bin/socket_base.h"
 
+#include <io.h>  // NOLINT
+
 #include "bin/builtin.h"
 #include "bin/eventhandler.h"
 #include "bin/file.h"
@@ -99,6 +101,30 @@ intptr_t SocketBase::RecvFrom(intptr_t fd,
   return handle->RecvFrom(buffer, num_bytes, &addr->addr, addr_len);
 }
 
+intptr_t SocketBase::RecvFromBatch(intptr_t fd,
+                                   uint8_t* buffer,
+                                   intptr_t slot_size,
+                                   intptr_t count,
+                                   intptr_t* lengths,
+                                   RawAddr* addrs,
+                                   SocketOpKind sync) {
+  ASSERT((count > 0) && (count <= kMaxRecvDatagrams));
+  Handle* handle = reinterpret_cast<Handle*>(fd);
+  // No batched receive, read one datagram at a time until none are left.
+  // Datagrams can be empty, so stop when no datagram is ready rather than
+  // on a zero-length read.
+  intptr_t received = 0;
+  while ((received < count) && handle->DataReady()) {
+    intptr_t read_bytes = RecvFrom(fd, buffer + received * slot_size,
+                                   slot_size, &addrs[received], sync);
+    if (read_bytes < 0) {
+      return (received > 0) ? received : read_bytes;
+    }
+    lengths[received++] = read_bytes;
+  }
+  return received;
+}
+
 bool SocketControlMessage::is_file_descriptors_control_message() {
   return false;
 }
@@ -128,6 +154,69 @@ intptr_t SocketBase::Write(intptr_t fd,
   return handle->Write(buffer, num_bytes);
 }
 
+intptr_t SocketBase::WriteV(intptr_t fd,
+                            const void* const* buffers,
+                            const intptr_t* lengths,
+                            intptr_t count,
+                            SocketOpKind sync) {
+  ASSERT((count > 0) && (count <= kMaxWriteVBuffers));
+  // No vectored write support, write the buffers one at a time and stop at
+  // the first short write.
+  intptr_t total = 0;
+  for (intptr_t i = 0; i < count; i++) {
+    intptr_t written_bytes = Write(fd, buffers[i], lengths[i], sync);
+    if (written_bytes < 0) {
+      return (total > 0) ? total : written_bytes;
+    }
+    total += written_bytes;
+    if (written_bytes < lengths[i]) {
+      break;
+    }
+  }
+  return total;
+}
+
+intptr_t SocketBase::SendFile(intptr_t fd,
+                              intptr_t file_fd,
+                              int64_t offset,
+                              intptr_t num_bytes,
+                              SocketOpKind sync) {
+  ASSERT(num_bytes > 0);
+  // Socket writes go through the overlapped buffers of the socket handle,
+  // which TransmitFile cannot use. Copy one buffer at a time instead. Bytes
+  // that are read but not written are read again by the next call.
+  const intptr_t kBufferSize = 16 * KB;
+  uint8_t buffer[kBufferSize];
+  HANDLE file_handle = reinterpret_cast<HANDLE>(_get_osfhandle(file_fd));
+  // ReadFile with an offset on a synchronous handle also moves the file
+  // pointer, which the file's own reads and writes rely on. Restore it.
+  LARGE_INTEGER zero;
+  zero.QuadPart = 0;
+  LARGE_INTEGER position;
+  if (!SetFilePointerEx(file_handle, zero, &position, FILE_CURRENT)) {
+    return -1;
+  }
+  OVERLAPPED overlapped;
+  ZeroMemory(&overlapped, sizeof(overlapped));
+  overlapped.Offset = static_cast<DWORD>(offset & 0xFFFFFFFF);
+  overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+  DWORD read_bytes = 0;
+  const bool read_ok = ReadFile(
+      file_handle, buffer,
+      static_cast<DWORD>(Utils::Minimum(num_bytes, kBufferSize)), &read_bytes,
+      &overlapped);
+  const DWORD read_error = GetLastError();
+  SetFilePointerEx(file_handle, position, NULL, FILE_BEGIN);
+  if (!read_ok) {
+    SetLastError(read_error);
+    return (read_error == ERROR_HANDLE_EOF) ? kEndOfFile : -1;
+  }
+  if (read_bytes == 0) {
+    return kEndOfFile;
+  }
+  return Write(fd, buffer, read_bytes, sync);
+}
+
 intptr_t SocketBase::SendTo(intptr_t fd,
                             const void* buffer,
                             intptr_t num_bytes,
@@ -384,6 +473,13 @@ AddressList<InterfaceSocketAddress>* SocketBase::ListInterfaces(
   return addresses;
 }
 
+intptr_t SocketBase::Duplicate(intptr_t fd) {
+  // Socket handles are not plain descriptors and cannot be shared with
+  // another thread this way.
+  SetLastError(ERROR_NOT_SUPPORTED);
+  return -1;
+}
+
 void SocketBase::Close(intptr_t fd) {
   ClientSocket* client_socket = reinterpret_cast<ClientSocket*>(fd);
   client_socket->Close();
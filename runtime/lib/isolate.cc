@@ -221,6 +221,8 @@ static ObjectPtr ValidateMessageObject(Zone* zone,
       case kExternalTwoByteStringCid:
       case kMintCid:
       case kImmutableArrayCid:
+      case kImmutableLinkedHashMapCid:
+      case kImmutableLinkedHashSetCid:
       case kNeverCid:
       case kSentinelCid:
       case kInt32x4Cid:
@@ -363,6 +365,58 @@ DEFINE_NATIVE_ENTRY(Isolate_exit_, 0, 2) {
   return Object::null();
 }
 
+// Finalized type arguments of [cls] instantiated with [type_args], as the
+// kernel loader computes them for constant maps and sets.
+static TypeArgumentsPtr ImmutableCollectionTypeArguments(
+    Zone* zone,
+    const Class& cls,
+    const TypeArguments& type_args) {
+  auto& type = Type::Handle(zone, Type::New(cls, type_args));
+  type ^= ClassFinalizer::FinalizeType(type, ClassFinalizer::kCanonicalize);
+  return type.arguments();
+}
+
+// The immutable maps and sets built by Isolate.freeze are the same kind of
+// object the VM creates for constant maps and sets. Their index is created
+// lazily on the first lookup.
+DEFINE_NATIVE_ENTRY(Isolate_immutableMap, 2, 1) {
+  GET_NON_NULL_NATIVE_ARGUMENT(Array, data, arguments->NativeArgAt(0));
+  ASSERT(data.IsImmutable());
+  const auto& map_class = Class::Handle(
+      zone,
+      isolate->group()->object_store()->immutable_linked_hash_map_class());
+  auto& type_args = TypeArguments::Handle(zone, arguments->NativeTypeArgs());
+  type_args = ImmutableCollectionTypeArguments(zone, map_class, type_args);
+
+  const auto& map = LinkedHashMap::Handle(
+      zone, ImmutableLinkedHashMap::NewUninitialized(Heap::kNew));
+  map.SetTypeArguments(type_args);
+  map.set_data(data);
+  map.set_used_data(data.Length());
+  map.set_deleted_keys(0);
+  map.ComputeAndSetHashMask();
+  return map.ptr();
+}
+
+DEFINE_NATIVE_ENTRY(Isolate_immutableSet, 1, 1) {
+  GET_NON_NULL_NATIVE_ARGUMENT(Array, data, arguments->NativeArgAt(0));
+  ASSERT(data.IsImmutable());
+  const auto& set_class = Class::Handle(
+      zone,
+      isolate->group()->object_store()->immutable_linked_hash_set_class());
+  auto& type_args = TypeArguments::Handle(zone, arguments->NativeTypeArgs());
+  type_args = ImmutableCollectionTypeArguments(zone, set_class, type_args);
+
+  const auto& set = LinkedHashSet::Handle(
+      zone, ImmutableLinkedHashSet::NewUninitialized(Heap::kNew));
+  set.SetTypeArguments(type_args);
+  set.set_data(data);
+  set.set_used_data(data.Length());
+  set.set_deleted_keys(0);
+  set.ComputeAndSetHashMask();
+  return set.ptr();
+}
+
 class IsolateSpawnState {
  public:
   IsolateSpawnState(Dart_Port parent_port,
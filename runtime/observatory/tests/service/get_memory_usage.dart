@@ -17,6 +17,11 @@ var tests = <VMTest>[
     expect(result['heapUsage'], isPositive);
     expect(result['heapCapacity'], isPositive);
     expect(result['externalUsage'], isPositive);
+    final footprint = result['_isolateFootprint'];
+    expect(footprint['isolate'], isPositive);
+    expect(footprint['messageHandler'], isPositive);
+    expect(footprint['fieldTable'], isPositive);
+    expect(footprint['total'], greaterThan(footprint['fieldTable']));
   },
   (VM vm) async {
     var params = {
@@ -0,0 +1,76 @@
+// Copyright (c) 2022, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+import 'dart:async';
+import 'dart:isolate';
+import 'dart:typed_data';
+
+import 'package:expect/expect.dart';
+
+class Key {}
+
+main() async {
+  final table = <String, Object?>{
+    'list': <int>[1, 2, 3],
+    'map': <int, String>{1: 'one', 2: 'two'},
+    'set': <String>{'a', 'b'},
+    'nested': <List<double>>[
+      <double>[1.5]
+    ],
+    'null': null,
+  };
+  final frozen = Isolate.freeze(table);
+
+  Expect.isTrue(frozen is Map<String, Object?>);
+  Expect.equals(table.length, frozen.length);
+  Expect.listEquals(table.keys.toList(), frozen.keys.toList());
+  Expect.isTrue(frozen['list'] is List<int>);
+  Expect.listEquals(<int>[1, 2, 3], frozen['list'] as List<int>);
+  Expect.equals('two', (frozen['map'] as Map<int, String>)[2]);
+  Expect.isTrue((frozen['set'] as Set<String>).contains('b'));
+  Expect.isFalse((frozen['set'] as Set<String>).contains('c'));
+  Expect.equals(1.5, (frozen['nested'] as List<List<double>>)[0][0]);
+  Expect.isNull(frozen['null']);
+
+  // The copy is deeply immutable and independent of the original.
+  Expect.throwsUnsupportedError(() => frozen['x'] = 1);
+  Expect.throwsUnsupportedError(() => (frozen['list'] as List<int>)[0] = 0);
+  Expect.throwsUnsupportedError(
+      () => (frozen['map'] as Map<int, String>)[3] = 'three');
+  Expect.throwsUnsupportedError(() => (frozen['set'] as Set<String>).add('c'));
+  (table['list'] as List<int>)[0] = 42;
+  Expect.equals(1, (frozen['list'] as List<int>)[0]);
+
+  Expect.throwsArgumentError(() => Isolate.freeze(Uint8List(1)));
+  Expect.throwsArgumentError(() => Isolate.freeze(Key()));
+  Expect.throwsArgumentError(() => Isolate.freeze(<Key, int>{Key(): 1}));
+  Expect.throwsArgumentError(() => Isolate.freeze(<Key>{Key()}));
+
+  // Cycles are rejected, shared objects without cycles are not.
+  final cyclic = <Object>[1];
+  cyclic.add(<String, Object>{'back': cyclic});
+  Expect.throwsArgumentError(() => Isolate.freeze(cyclic));
+  final selfMap = <String, Object>{};
+  selfMap['self'] = selfMap;
+  Expect.throwsArgumentError(() => Isolate.freeze(selfMap));
+  final shared = <int>[7];
+  final diamond = Isolate.freeze(<List<int>>[shared, shared]);
+  Expect.listEquals(<int>[7], diamond[0]);
+  Expect.listEquals(<int>[7], diamond[1]);
+  // A shared collection is frozen once.
+  Expect.isTrue(identical(diamond[0], diamond[1]));
+  final sharedMap = <String, List<int>>{'a': shared};
+  final twice = Isolate.freeze(<Object>[sharedMap, sharedMap, shared]);
+  Expect.isTrue(identical(twice[0], twice[1]));
+  Expect.isTrue(
+      identical((twice[0] as Map<String, List<int>>)['a'], twice[2]));
+
+  // Frozen objects are sent by reference within an isolate group.
+  final port = ReceivePort();
+  final inbox = StreamIterator(port);
+  port.sendPort.send(frozen);
+  Expect.isTrue(await inbox.moveNext());
+  Expect.isTrue(identical(frozen, inbox.current));
+  port.close();
+}
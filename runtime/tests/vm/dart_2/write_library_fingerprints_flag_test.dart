@@ -0,0 +1,103 @@
+// Copyright (c) 2022, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// @dart = 2.9
+
+// This test ensures that --write-library-fingerprints-to prints valid JSON
+// and that only the fingerprint of a changed library changes.
+
+import "dart:convert";
+import "dart:io";
+
+import 'package:expect/expect.dart';
+import 'package:path/path.dart' as path;
+
+import 'use_flag_test_helper.dart';
+
+const programA = '''
+int compute(int x) => x + 1;
+main() => print(compute(41));
+''';
+
+const programB = '''
+int compute(int x) => x + 2;
+main() => print(compute(40));
+''';
+
+main(List<String> args) async {
+  if (!isAOTRuntime) {
+    return; // Running in JIT: AOT binaries not available.
+  }
+
+  if (Platform.isAndroid) {
+    return; // SDK tree and dart_bootstrap not available on the test device.
+  }
+
+  // These are the tools we need to be available to run on a given platform:
+  if (!await testExecutable(genSnapshot)) {
+    throw "Cannot run test as $genSnapshot not available";
+  }
+  if (!File(platformDill).existsSync()) {
+    throw "Cannot run test as $platformDill does not exist";
+  }
+
+  await withTempDir('library-fingerprints-flag-test', (String tempDir) async {
+    final script = path.join(tempDir, 'program.dart');
+    final scriptUri = Uri.file(script).toString();
+
+    final first = await fingerprintsOf(tempDir, script, programA);
+    final again = await fingerprintsOf(tempDir, script, programA);
+    final second = await fingerprintsOf(tempDir, script, programB);
+
+    Expect.isTrue(first.containsKey(scriptUri), 'no entry for $scriptUri');
+    Expect.isTrue(first.containsKey('dart:core'), 'no entry for dart:core');
+
+    // Fingerprints are stable across compilations of the same sources.
+    Expect.mapEquals(first, again);
+
+    // Only the edited library changes its fingerprint.
+    Expect.notEquals(first[scriptUri], second[scriptUri]);
+    Expect.setEquals(first.keys, second.keys);
+    for (final library in first.keys) {
+      if (library == scriptUri) continue;
+      Expect.equals(first[library], second[library], library);
+    }
+  });
+}
+
+Future<Map<String, int>> fingerprintsOf(
+    String tempDir, String script, String source) async {
+  final scriptDill = path.join(tempDir, 'program.dill');
+  final fingerprintsFile = path.join(tempDir, 'fingerprints.json');
+  final snapshot = path.join(tempDir, 'snapshot.so');
+
+  File(script).writeAsStringSync(source);
+  await run(genKernel, <String>[
+    '--aot',
+    '--platform=$platformDill',
+    '-o',
+    scriptDill,
+    script,
+  ]);
+  await run(genSnapshot, <String>[
+    '--write-library-fingerprints-to=$fingerprintsFile',
+    '--snapshot-kind=app-aot-elf',
+    '--elf=$snapshot',
+    scriptDill,
+  ]);
+
+  final fingerprintsJson =
+      json.decode(await File(fingerprintsFile).readAsString());
+  Expect.isTrue(fingerprintsJson is List, 'not a list of libraries');
+  final result = <String, int>{};
+  for (final entry in fingerprintsJson as List) {
+    Expect.isTrue(entry is Map, 'not a library object');
+    final m = entry as Map;
+    Expect.isTrue(m["library"] is String, 'library field is not a string');
+    Expect.isTrue(m["fingerprint"] is int, 'fingerprint field is not an int');
+    Expect.isFalse(result.containsKey(m["library"]), 'duplicate library');
+    result[m["library"] as String] = m["fingerprint"] as int;
+  }
+  return result;
+}
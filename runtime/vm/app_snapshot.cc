@@ -60,6 +60,11 @@ DEFINE_FLAG(bool,
             "ROData optimizations.");
 #endif  // defined(DART_PRECOMPILER)
 
+DEFINE_FLAG(bool,
+            print_snapshot_page_faults,
+            false,
+            "Print the number of page faults incurred while reading snapshots.");
+
 namespace {
 // StorageTrait for HashTable which allows to create hash tables backed by
 // zone memory. Used to compute cluster order for canonical clusters.
@@ -2814,7 +2819,7 @@ class CodeSourceMapSerializationCluster : public SerializationCluster {
       const intptr_t length = map->untag()->length_;
       s->WriteUnsigned(length);
       target_memory_size_ +=
-          compiler::target::PcDescriptors::InstanceSize(length);
+          compiler::target::CodeSourceMap::InstanceSize(length);
     }
   }
 
@@ -2859,7 +2864,7 @@ class CodeSourceMapDeserializationCluster : public DeserializationCluster {
     for (intptr_t id = start_index_, n = stop_index_; id < n; id++) {
       const intptr_t length = d.ReadUnsigned();
       CodeSourceMapPtr map = static_cast<CodeSourceMapPtr>(d.Ref(id));
-      Deserializer::InitializeHeader(map, kPcDescriptorsCid,
+      Deserializer::InitializeHeader(map, kCodeSourceMapCid,
                                      CodeSourceMap::InstanceSize(length));
       map->untag()->length_ = length;
       uint8_t* cdata = reinterpret_cast<uint8_t*>(map->untag()->data());
@@ -8831,7 +8836,37 @@ bool SnapshotHeaderReader::NullSafetyFromSnapshot(const Snapshot* snapshot) {
   return null_safety;
 }
 
+// Reports the number of page faults incurred during its lifetime when
+// --print_snapshot_page_faults is enabled. Used to measure how well the
+// snapshot layout keeps the pages touched at startup together.
+class SnapshotPageFaultScope : public ValueObject {
+ public:
+  explicit SnapshotPageFaultScope(const char* name)
+      : name_(name),
+        enabled_(FLAG_print_snapshot_page_faults &&
+                 OS::GetPageFaultCounts(&minor_start_, &major_start_)) {}
+
+  ~SnapshotPageFaultScope() {
+    int64_t minor_end, major_end;
+    if (enabled_ && OS::GetPageFaultCounts(&minor_end, &major_end)) {
+      OS::PrintErr("Reading %s snapshot: %" Pd64 " minor, %" Pd64
+                   " major page faults\n",
+                   name_, minor_end - minor_start_, major_end - major_start_);
+    }
+  }
+
+ private:
+  const char* const name_;
+  int64_t minor_start_ = 0;
+  int64_t major_start_ = 0;
+  const bool enabled_;
+
+  DISALLOW_COPY_AND_ASSIGN(SnapshotPageFaultScope);
+};
+
 ApiErrorPtr FullSnapshotReader::ReadVMSnapshot() {
+  SnapshotPageFaultScope page_faults("VM");
+
   SnapshotHeaderReader header_reader(kind_, buffer_, size_);
 
   intptr_t offset = 0;
@@ -8874,6 +8909,7 @@ ApiErrorPtr FullSnapshotReader::ReadVMSnapshot() {
 }
 
 ApiErrorPtr FullSnapshotReader::ReadProgramSnapshot() {
+  SnapshotPageFaultScope page_faults("program");
   SnapshotHeaderReader header_reader(kind_, buffer_, size_);
   intptr_t offset = 0;
   char* error =
@@ -604,6 +604,92 @@ BENCHMARK(LargeMap) {
   benchmark->set_score(elapsed_time);
 }
 
+//
+// Measure the latency from Dart_PostCObject to the invocation of the handler
+// of a native port, which runs on another thread.
+//
+static Monitor* post_cobject_monitor = nullptr;
+static intptr_t post_cobject_received = 0;
+
+static void PostCObjectCountingHandler(Dart_Port dest_port_id,
+                                       Dart_CObject* message) {
+  MonitorLocker ml(post_cobject_monitor);
+  post_cobject_received++;
+  ml.Notify();
+}
+
+BENCHMARK(PostCObjectToNativePort) {
+  const intptr_t kLoopCount = 100000;
+  Monitor monitor;
+  post_cobject_monitor = &monitor;
+  post_cobject_received = 0;
+  Dart_Port port_id = Dart_NewNativePort(
+      "PostCObjectToNativePort", PostCObjectCountingHandler, false);
+  EXPECT(port_id != ILLEGAL_PORT);
+  Dart_CObject message;
+  message.type = Dart_CObject_kInt64;
+  Timer timer;
+  timer.Start();
+  for (intptr_t i = 0; i < kLoopCount; i++) {
+    message.value.as_int64 = i;
+    Dart_PostCObject(port_id, &message);
+    MonitorLocker ml(&monitor);
+    while (post_cobject_received <= i) {
+      ml.Wait();
+    }
+  }
+  timer.Stop();
+  int64_t elapsed_time = timer.TotalElapsedTime();
+  Dart_CloseNativePort(port_id);
+  post_cobject_monitor = nullptr;
+  benchmark->set_score(elapsed_time);
+}
+
+//
+// Measure the cost from Dart_PostCObject to the invocation of the handler of
+// a RawReceivePort, without the wakeup of the isolate's thread.
+//
+BENCHMARK(PostCObjectToDartHandler) {
+  const char* kScriptChars =
+      "import 'dart:isolate';\n"
+      "int received = 0;\n"
+      "final port = new RawReceivePort((_) { received++; });\n"
+      "SendPort getSendPort() => port.sendPort;\n"
+      "int closePort() {\n"
+      "  port.close();\n"
+      "  return received;\n"
+      "}\n";
+  const intptr_t kLoopCount = 100000;
+  Dart_Handle lib = TestCase::LoadTestScript(kScriptChars, NULL);
+  EXPECT_VALID(lib);
+  Dart_Handle send_port = Dart_Invoke(lib, NewString("getSendPort"), 0, NULL);
+  EXPECT_VALID(send_port);
+  Dart_Port port_id = ILLEGAL_PORT;
+  EXPECT_VALID(Dart_SendPortGetId(send_port, &port_id));
+  Dart_CObject message;
+  message.type = Dart_CObject_kInt64;
+  Timer timer;
+  timer.Start();
+  for (intptr_t i = 0; i < kLoopCount; i++) {
+    message.value.as_int64 = i;
+    Dart_PostCObject(port_id, &message);
+    Dart_EnterScope();
+    Dart_Handle result = Dart_HandleMessage();
+    if (Dart_IsError(result)) {
+      FATAL1("Failed to handle message: %s", Dart_GetError(result));
+    }
+    Dart_ExitScope();
+  }
+  timer.Stop();
+  int64_t elapsed_time = timer.TotalElapsedTime();
+  Dart_Handle received = Dart_Invoke(lib, NewString("closePort"), 0, NULL);
+  EXPECT_VALID(received);
+  int64_t received_count = 0;
+  EXPECT_VALID(Dart_IntegerToInt64(received, &received_count));
+  EXPECT_EQ(kLoopCount, received_count);
+  benchmark->set_score(elapsed_time);
+}
+
 BENCHMARK_MEMORY(InitialRSS) {
   benchmark->set_score(bin::Process::MaxRSS());
 }
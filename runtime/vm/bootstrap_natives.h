@@ -305,6 +305,8 @@ namespace dart {
   V(Isolate_getCurrentRootUriStr, 0)                                           \
   V(Isolate_getDebugName, 1)                                                   \
   V(Isolate_getPortAndCapabilitiesOfCurrentIsolate, 0)                         \
+  V(Isolate_immutableMap, 1)                                                   \
+  V(Isolate_immutableSet, 1)                                                   \
   V(Isolate_registerKernelBlob, 1)                                             \
   V(Isolate_unregisterKernelBlob, 1)                                           \
   V(Isolate_sendOOB, 2)                                                        \
@@ -31,6 +31,7 @@
 #include "vm/compiler/compiler_state.h"
 #include "vm/compiler/compiler_timings.h"
 #include "vm/compiler/frontend/flow_graph_builder.h"
+#include "vm/compiler/frontend/kernel_fingerprints.h"
 #include "vm/compiler/frontend/kernel_to_il.h"
 #include "vm/compiler/jit/compiler.h"
 #include "vm/dart_entry.h"
@@ -82,6 +83,10 @@ DEFINE_FLAG(charp,
             write_retained_reasons_to,
             nullptr,
             "Print reasons for retaining objects to the given file");
+DEFINE_FLAG(charp,
+            write_library_fingerprints_to,
+            nullptr,
+            "Print source fingerprints of all libraries to the given file");
 
 DECLARE_FLAG(bool, print_flow_graph);
 DECLARE_FLAG(bool, print_flow_graph_optimized);
@@ -479,6 +484,10 @@ void Precompiler::DoCompileAll() {
         IG->class_table()->PrintObjectLayout(FLAG_print_object_layout_to);
       }
 
+      if (FLAG_write_library_fingerprints_to != nullptr) {
+        WriteLibraryFingerprints(FLAG_write_library_fingerprints_to);
+      }
+
       ClassFinalizer::SortClasses();
 
       // Collects type usage information which allows us to decide when/how to
@@ -3374,6 +3383,53 @@ void Precompiler::Obfuscate() {
   IG->object_store()->set_obfuscation_map(Array::Handle(Z));
 }
 
+// Writes the URI and fingerprint of every library as JSON, so that build
+// systems can tell which libraries changed between two compilations. See
+// KernelSourceFingerprintHelper::CalculateLibraryFingerprint for what the
+// fingerprint covers.
+void Precompiler::WriteLibraryFingerprints(const char* filename) {
+  auto file_open = Dart::file_open_callback();
+  auto file_write = Dart::file_write_callback();
+  auto file_close = Dart::file_close_callback();
+  if ((file_open == nullptr) || (file_write == nullptr) ||
+      (file_close == nullptr)) {
+    OS::PrintErr("warning: Could not access file callbacks.");
+    return;
+  }
+
+  Library& lib = Library::Handle(Z);
+  String& url = String::Handle(Z);
+  JSONWriter js;
+  js.OpenArray();
+  for (intptr_t i = 0; i < libraries_.Length(); i++) {
+    lib ^= libraries_.At(i);
+    HANDLESCOPE(T);
+    url = lib.url();
+    js.OpenObject();
+    js.PrintProperty("library", url.ToCString());
+    js.PrintProperty64(
+        "fingerprint",
+        kernel::KernelSourceFingerprintHelper::CalculateLibraryFingerprint(
+            lib));
+    js.CloseObject();
+  }
+  js.CloseArray();
+
+  void* file = file_open(filename, /*write=*/true);
+  if (file == nullptr) {
+    OS::PrintErr("warning: Failed to write library fingerprints: %s\n",
+                 filename);
+    return;
+  }
+
+  char* output = nullptr;
+  intptr_t output_length = 0;
+  js.Steal(&output, &output_length);
+  file_write(output, output_length, file);
+  free(output);
+  file_close(file);
+}
+
 void Precompiler::FinalizeAllClasses() {
   // Create a fresh Zone because kernel reading during class finalization
   // may create zone handles. Those handles may prevent garbage collection of
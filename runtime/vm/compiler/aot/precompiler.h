@@ -388,6 +388,7 @@ class Precompiler : public ValueObject {
   void PrecompileConstructors();
 
   void FinalizeAllClasses();
+  void WriteLibraryFingerprints(const char* filename);
 
   IsolateGroup* isolate_group() const { return thread_->isolate_group(); }
 
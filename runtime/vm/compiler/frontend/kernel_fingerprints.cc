@@ -942,5 +942,24 @@ uint32_t KernelSourceFingerprintHelper::CalculateFunctionFingerprint(
   return helper.CalculateFunctionFingerprint();
 }
 
+uint32_t KernelSourceFingerprintHelper::CalculateLibraryFingerprint(
+    const Library& library) {
+  Zone* zone = Thread::Current()->zone();
+  const String& url = String::Handle(zone, library.url());
+
+  uint32_t hash = 0;
+  hash = KernelFingerprintHelper::CalculateHash(hash, url.Hash());
+
+  Class& klass = Class::Handle(zone);
+  ClassDictionaryIterator it(library, ClassDictionaryIterator::kIteratePrivate);
+  while (it.HasNext()) {
+    klass = it.GetNextClass();
+    uint32_t fingerprint = CalculateClassFingerprint(klass);
+    hash = KernelFingerprintHelper::CalculateHash(hash, fingerprint);
+  }
+
+  return hash;
+}
+
 }  // namespace kernel
 }  // namespace dart
@@ -20,6 +20,12 @@ class KernelSourceFingerprintHelper : public AllStatic {
   static uint32_t CalculateClassFingerprint(const Class& klass);
   static uint32_t CalculateFieldFingerprint(const Field& field);
   static uint32_t CalculateFunctionFingerprint(const Function& func);
+
+  // Combines the hash of the library URI with the fingerprints of all classes
+  // of the library, including its top-level class. A class fingerprint covers
+  // the class name, its supertype and interfaces, and the fingerprints of its
+  // fields and functions.
+  static uint32_t CalculateLibraryFingerprint(const Library& library);
 };
 
 }  // namespace kernel
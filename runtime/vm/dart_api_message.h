@@ -18,12 +18,13 @@ namespace dart {
 // This class handles translation of certain RawObjects to CObjects for
 // NativeMessageHandlers.
 //
-// TODO(zra): Expand to support not only null, but also other VM heap objects
-// as well.
+// TODO(zra): Expand to support not only null and bools, but also other VM
+// heap objects as well.
 class ApiObjectConverter : public AllStatic {
  public:
   static bool CanConvert(const ObjectPtr raw_obj) {
-    return !raw_obj->IsHeapObject() || (raw_obj == Object::null());
+    return !raw_obj->IsHeapObject() || (raw_obj == Object::null()) ||
+           (raw_obj == Bool::True().ptr()) || (raw_obj == Bool::False().ptr());
   }
 
   static bool Convert(const ObjectPtr raw_obj, Dart_CObject* c_obj) {
@@ -31,6 +32,10 @@ class ApiObjectConverter : public AllStatic {
       ConvertSmi(static_cast<const SmiPtr>(raw_obj), c_obj);
     } else if (raw_obj == Object::null()) {
       ConvertNull(c_obj);
+    } else if (raw_obj == Bool::True().ptr()) {
+      ConvertBool(true, c_obj);
+    } else if (raw_obj == Bool::False().ptr()) {
+      ConvertBool(false, c_obj);
     } else {
       return false;
     }
@@ -54,6 +59,11 @@ class ApiObjectConverter : public AllStatic {
     c_obj->type = Dart_CObject_kNull;
     c_obj->value.as_int64 = 0;
   }
+
+  static void ConvertBool(bool value, Dart_CObject* c_obj) {
+    c_obj->type = Dart_CObject_kBool;
+    c_obj->value.as_bool = value;
+  }
 };
 
 }  // namespace dart
@@ -1141,7 +1141,8 @@ Elf::Elf(Zone* zone, BaseWriteStream* stream, Type type, Dwarf* dwarf)
       unwrapped_stream_(stream),
       type_(type),
       dwarf_(dwarf),
-      section_table_(new (zone) SectionTable(zone)) {
+      section_table_(new (zone) SectionTable(zone)),
+      dwarf_buffers_(zone, 0) {
   // Separate debugging information should always have a Dwarf object.
   ASSERT(type_ == Type::Snapshot || dwarf_ != nullptr);
   // Assumed by various offset logic in this file.
@@ -1474,32 +1475,40 @@ void Elf::FinalizeDwarfSections() {
   // Currently we only output DWARF information involving code.
   ASSERT(section_table_->HasSectionNamed(kTextName));
 
-  auto add_debug = [&](const char* name, const DwarfElfStream& stream) {
+  // The DWARF sections are written into malloc'd buffers instead of the zone.
+  // Growing a zone buffer leaves the previous copy behind whenever other zone
+  // allocations (like relocations) happened in between, roughly doubling the
+  // memory used for debugging information, whereas realloc can grow in place
+  // and the buffers can be released as soon as the ELF file is written.
+  auto add_debug = [&](const char* name, MallocWriteStream* stream,
+                       const DwarfElfStream& dwarf_stream) {
     auto const container =
         new (zone_) BitsContainer(elf::SectionHeaderType::SHT_PROGBITS);
-    container->AddPortion(stream.buffer(), stream.bytes_written(),
-                          stream.relocations());
+    intptr_t size;
+    uint8_t* const bytes = stream->Steal(&size);
+    dwarf_buffers_.Add(bytes);
+    container->AddPortion(bytes, size, dwarf_stream.relocations());
     section_table_->Add(container, name);
   };
   {
-    ZoneWriteStream stream(zone(), kInitialDwarfBufferSize);
+    MallocWriteStream stream(kInitialDwarfBufferSize);
     DwarfElfStream dwarf_stream(zone_, &stream);
     dwarf_->WriteAbbreviations(&dwarf_stream);
-    add_debug(".debug_abbrev", dwarf_stream);
+    add_debug(".debug_abbrev", &stream, dwarf_stream);
   }
 
   {
-    ZoneWriteStream stream(zone(), kInitialDwarfBufferSize);
+    MallocWriteStream stream(kInitialDwarfBufferSize);
     DwarfElfStream dwarf_stream(zone_, &stream);
     dwarf_->WriteDebugInfo(&dwarf_stream);
-    add_debug(".debug_info", dwarf_stream);
+    add_debug(".debug_info", &stream, dwarf_stream);
   }
 
   {
-    ZoneWriteStream stream(zone(), kInitialDwarfBufferSize);
+    MallocWriteStream stream(kInitialDwarfBufferSize);
     DwarfElfStream dwarf_stream(zone_, &stream);
     dwarf_->WriteLineNumberProgram(&dwarf_stream);
-    add_debug(".debug_line", dwarf_stream);
+    add_debug(".debug_line", &stream, dwarf_stream);
   }
 }
 
@@ -1753,6 +1762,12 @@ void Elf::Finalize() {
   }
   // Finally, write the section table.
   write_section(section_table_);
+
+  // The section contents have been written out, so release the DWARF buffers.
+  for (auto* const buffer : dwarf_buffers_) {
+    free(buffer);
+  }
+  dwarf_buffers_.Clear();
 }
 
 // For the build ID, we generate a 128-bit hash, where each 32 bits is a hash of
@@ -132,6 +132,9 @@ class Elf : public ZoneAllocated {
   // even though they may not end up in the final ELF file.
   SymbolTable* symtab_ = nullptr;
 
+  // Malloc'd contents of the DWARF sections, freed once written in Finalize.
+  GrowableArray<uint8_t*> dwarf_buffers_;
+
   friend class SectionTable;  // For section name static fields.
 };
 
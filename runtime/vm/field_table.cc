@@ -128,12 +128,18 @@ FieldTable* FieldTable::Clone(Isolate* for_isolate) {
       IsolateGroup::Current()->program_lock()->IsCurrentThreadReader());
 
   FieldTable* clone = new FieldTable(for_isolate);
+  // The clone grows on demand if more fields get registered later on.
+  intptr_t capacity = Utils::RoundUp(top_ + 1, kCloneCapacityAlignment);
+  capacity = Utils::Minimum(capacity, capacity_);
   auto new_table =
-      static_cast<ObjectPtr*>(malloc(capacity_ * sizeof(ObjectPtr)));  // NOLINT
-  memmove(new_table, table_, capacity_ * sizeof(ObjectPtr));
+      static_cast<ObjectPtr*>(malloc(capacity * sizeof(ObjectPtr)));  // NOLINT
+  memmove(new_table, table_, top_ * sizeof(ObjectPtr));
+  for (intptr_t i = top_; i < capacity; i++) {
+    new_table[i] = ObjectPtr();
+  }
   ASSERT(clone->table_ == nullptr);
   clone->table_ = new_table;
-  clone->capacity_ = capacity_;
+  clone->capacity_ = capacity;
   clone->top_ = top_;
   clone->free_head_ = free_head_;
   return clone;
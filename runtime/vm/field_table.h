@@ -48,6 +48,9 @@ class FieldTable {
 
   bool IsValidIndex(intptr_t index) const { return index >= 0 && index < top_; }
 
+  // Whether registering another field has to grow the backing store.
+  bool IsFull() const { return free_head_ < 0 && top_ == capacity_; }
+
   // Returns whether registering this field caused a growth in the backing
   // store.
   bool Register(const Field& field, intptr_t expected_field_id = -1);
@@ -93,6 +96,9 @@ class FieldTable {
 
   static const int kInitialCapacity = 512;
   static const int kCapacityIncrement = 256;
+  // Clones only get a little room to grow, since every isolate of a group
+  // has its own clone.
+  static const int kCloneCapacityAlignment = 32;
 
  private:
   friend class GCMarker;
@@ -935,12 +935,20 @@ void IsolateGroup::RegisterStaticField(const Field& field,
   ASSERT(program_lock()->IsCurrentThreadWriter());
 
   ASSERT(field.is_static());
-  const bool need_to_grow_backing_store =
-      initial_field_table()->Register(field);
+  bool need_to_grow_backing_store = initial_field_table()->Register(field);
   const intptr_t field_id = field.field_id();
   initial_field_table()->SetAt(field_id, initial_value.ptr());
 
   SafepointReadRwLocker ml(Thread::Current(), isolates_lock_.get());
+  // The isolates' field tables have less spare capacity than the initial one
+  // (see FieldTable::Clone), so they might have to grow on their own.
+  for (auto isolate : isolates_) {
+    auto field_table = isolate->field_table();
+    if (field_table->IsReadyToUse() && field_table->IsFull()) {
+      need_to_grow_backing_store = true;
+      break;
+    }
+  }
   if (need_to_grow_backing_store) {
     // We have to stop other isolates from accessing their field state, since
     // we'll have to grow the backing store.
@@ -1059,6 +1067,7 @@ class IsolateMessageHandler : public MessageHandler {
   const char* name() const;
   void MessageNotify(Message::Priority priority);
   MessageStatus HandleMessage(std::unique_ptr<Message> message);
+  MessageStatus HandleMessageBatch(std::unique_ptr<Message> message);
 #ifndef PRODUCT
   void NotifyPauseOnStart();
   void NotifyPauseOnExit();
@@ -1077,6 +1086,10 @@ class IsolateMessageHandler : public MessageHandler {
   // processing of further events.
   ErrorPtr HandleLibMessage(const Array& message);
 
+  // Reads and dispatches [message] in the zone and handle scope of the
+  // caller.
+  MessageStatus DispatchMessage(Thread* thread, Message* message);
+
   MessageStatus ProcessUnhandledException(const Error& result);
   Isolate* isolate_;
 };
@@ -1329,7 +1342,6 @@ MessageHandler::MessageStatus IsolateMessageHandler::HandleMessage(
   ASSERT(IsCurrentIsolate());
   Thread* thread = Thread::Current();
   StackZone stack_zone(thread);
-  Zone* zone = stack_zone.GetZone();
   HandleScope handle_scope(thread);
 #if defined(SUPPORT_TIMELINE)
   TimelineBeginEndScope tbes(
@@ -1338,9 +1350,50 @@ MessageHandler::MessageStatus IsolateMessageHandler::HandleMessage(
   tbes.SetNumArguments(1);
   tbes.CopyArgument(0, "isolateName", I->name());
 #endif
+  return DispatchMessage(thread, message.get());
+}
+
+MessageHandler::MessageStatus IsolateMessageHandler::HandleMessageBatch(
+    std::unique_ptr<Message> message) {
+  ASSERT(IsCurrentIsolate());
+  Thread* thread = Thread::Current();
+  // The messages of a batch are read into the same zone, which lives until
+  // the whole batch has been handled.
+  StackZone stack_zone(thread);
+  HandleScope handle_scope(thread);
+#if defined(SUPPORT_TIMELINE)
+  TimelineBeginEndScope tbes(thread, Timeline::GetIsolateStream(),
+                             "HandleMessageBatch");
+  tbes.SetNumArguments(2);
+  tbes.CopyArgument(0, "isolateName", I->name());
+#endif
+  MessageStatus status = kOK;
+  intptr_t batched = 0;
+  while (message != nullptr) {
+    {
+      HANDLESCOPE(thread);
+      status = DispatchMessage(thread, message.get());
+    }
+    message.reset();
+    batched++;
+    if (status != kOK) {
+      break;
+    }
+    message = DequeueBatchedMessage(batched);
+  }
+#if defined(SUPPORT_TIMELINE)
+  tbes.FormatArgument(1, "messages", "%" Pd, batched);
+#endif
+  return status;
+}
+
+MessageHandler::MessageStatus IsolateMessageHandler::DispatchMessage(
+    Thread* thread,
+    Message* message) {
+  Zone* zone = thread->zone();
 
   // Parse the message.
-  Object& msg_obj = Object::Handle(zone, ReadMessage(thread, message.get()));
+  Object& msg_obj = Object::Handle(zone, ReadMessage(thread, message));
   if (msg_obj.IsError()) {
     // An error occurred while reading the message.
     return ProcessUnhandledException(Error::Cast(msg_obj));
@@ -3271,7 +3324,32 @@ void Isolate::PrintJSON(JSONStream* stream, bool ref) {
 }
 
 void Isolate::PrintMemoryUsageJSON(JSONStream* stream) {
-  group()->heap()->PrintMemoryUsageJSON(stream);
+  JSONObject jsobj(stream);
+  group()->heap()->PrintMemoryUsageJSON(&jsobj);
+
+  // The heap is shared by all isolates of the group. Report the native memory
+  // owned by this isolate separately.
+  const intptr_t isolate_size = sizeof(Isolate);
+  const intptr_t thread_size =
+      mutator_thread_ != nullptr ? sizeof(Thread) : 0;
+  const intptr_t message_handler_size = sizeof(IsolateMessageHandler);
+  const intptr_t field_table_size =
+      field_table_ != nullptr ? field_table_->Capacity() * kWordSize : 0;
+  const intptr_t object_id_ring_size =
+      object_id_ring_ != nullptr
+          ? sizeof(ObjectIdRing) + object_id_ring_->SizeInBytes()
+          : 0;
+  const intptr_t debugger_size = debugger_ != nullptr ? sizeof(Debugger) : 0;
+  JSONObject footprint(&jsobj, "_isolateFootprint");
+  footprint.AddProperty64("isolate", isolate_size);
+  footprint.AddProperty64("mutatorThread", thread_size);
+  footprint.AddProperty64("messageHandler", message_handler_size);
+  footprint.AddProperty64("fieldTable", field_table_size);
+  footprint.AddProperty64("objectIdRing", object_id_ring_size);
+  footprint.AddProperty64("debugger", debugger_size);
+  footprint.AddProperty64(
+      "total", isolate_size + thread_size + message_handler_size +
+                   field_table_size + object_id_ring_size + debugger_size);
 }
 
 #endif
@@ -35,6 +35,22 @@ Message::Message(Dart_Port dest_port, ObjectPtr raw_obj, Priority priority)
   ASSERT(IsRaw());
 }
 
+Message::Message(Dart_Port dest_port, int64_t value, Priority priority)
+    : dest_port_(dest_port),
+      payload_(value),
+      snapshot_length_(kInt64SnapshotLen),
+      priority_(priority) {
+  ASSERT(IsInt64());
+}
+
+Message::Message(Dart_Port dest_port, double value, Priority priority)
+    : dest_port_(dest_port),
+      payload_(value),
+      snapshot_length_(kDoubleSnapshotLen),
+      priority_(priority) {
+  ASSERT(IsDouble());
+}
+
 Message::Message(Dart_Port dest_port,
                  PersistentHandle* handle,
                  Priority priority)
@@ -62,6 +62,12 @@ class Message {
   // the VM heap. This is indicated by setting the len_ field to 0.
   Message(Dart_Port dest_port, ObjectPtr raw_obj, Priority priority);
 
+  // Messages carrying a single int64 or double posted from native code. The
+  // receiver boxes the value itself, which avoids serializing a snapshot for
+  // values that do not fit into a Smi.
+  Message(Dart_Port dest_port, int64_t value, Priority priority);
+  Message(Dart_Port dest_port, double value, Priority priority);
+
   // A message sent from SendPort.send or SendPort.sendAndExit where sender and
   // receiver are in the same isolate group.
   Message(Dart_Port dest_port, PersistentHandle* handle, Priority priority);
@@ -98,6 +104,14 @@ class Message {
     ASSERT(IsRaw());
     return payload_.raw_obj_;
   }
+  int64_t int64_value() const {
+    ASSERT(IsInt64());
+    return payload_.int64_value_;
+  }
+  double double_value() const {
+    ASSERT(IsDouble());
+    return payload_.double_value_;
+  }
   PersistentHandle* persistent_handle() const {
     ASSERT(IsPersistentHandle() || IsFinalizerInvocationRequest());
     return payload_.persistent_handle_;
@@ -109,10 +123,14 @@ class Message {
   // vm-service requests.
   bool IsOOB() const { return priority_ == Message::kOOBPriority; }
   bool IsSnapshot() const {
-    return !IsRaw() && !IsPersistentHandle() && !IsFinalizerInvocationRequest();
+    return !IsRaw() && !IsInt64() && !IsDouble() && !IsPersistentHandle() &&
+           !IsFinalizerInvocationRequest();
   }
   // A message whose object is an immortal object from the vm-isolate's heap.
   bool IsRaw() const { return snapshot_length_ == 0; }
+  // A message carrying an unboxed int64 or double value.
+  bool IsInt64() const { return snapshot_length_ == kInt64SnapshotLen; }
+  bool IsDouble() const { return snapshot_length_ == kDoubleSnapshotLen; }
   // A message sent from SendPort.send or SendPort.sendAndExit where sender and
   // receiver are in the same isolate group.
   bool IsPersistentHandle() const {
@@ -136,7 +154,10 @@ class Message {
  private:
   static intptr_t const kPersistentHandleSnapshotLen = -1;
   static intptr_t const kFinalizerSnapshotLen = -2;
+  static intptr_t const kInt64SnapshotLen = -3;
+  static intptr_t const kDoubleSnapshotLen = -4;
 
+  friend class MessageHandler;
   friend class MessageQueue;
 
   Message* next_ = nullptr;
@@ -144,11 +165,15 @@ class Message {
   union Payload {
     Payload(uint8_t* snapshot) : snapshot_(snapshot) {}
     Payload(ObjectPtr raw_obj) : raw_obj_(raw_obj) {}
+    Payload(int64_t int64_value) : int64_value_(int64_value) {}
+    Payload(double double_value) : double_value_(double_value) {}
     Payload(PersistentHandle* persistent_handle)
         : persistent_handle_(persistent_handle) {}
 
     uint8_t* snapshot_;
     ObjectPtr raw_obj_;
+    int64_t int64_value_;
+    double double_value_;
     PersistentHandle* persistent_handle_;
   } payload_;
   intptr_t snapshot_length_ = 0;
@@ -170,6 +195,10 @@ class MessageQueue {
   // message is available.  This function will not block.
   std::unique_ptr<Message> Dequeue();
 
+  // Returns the next message without removing it, or NULL if the queue is
+  // empty.
+  Message* Peek() const { return head_; }
+
   bool IsEmpty() { return head_ == NULL; }
 
   // Clear all messages from the message queue.
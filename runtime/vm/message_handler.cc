@@ -19,6 +19,14 @@
 namespace dart {
 
 DECLARE_FLAG(bool, trace_service_pause_events);
+DEFINE_FLAG(int,
+            message_batch_size,
+            32,
+            "Maximum number of normal messages handled in one batch.");
+
+// Larger messages end a batch so that the memory used to read them is
+// released before reading the next one.
+static constexpr intptr_t kMaxBatchedMessageSize = 4 * KB;
 
 class MessageHandlerTask : public ThreadPool::Task {
  public:
@@ -55,7 +63,8 @@ const char* MessageHandler::MessageStatusString(MessageStatus status) {
 }
 
 MessageHandler::MessageHandler()
-    : queue_(new MessageQueue()),
+    : incoming_(nullptr),
+      queue_(new MessageQueue()),
       oob_queue_(new MessageQueue()),
       oob_message_handling_allowed_(true),
       paused_for_messages_(false),
@@ -71,6 +80,7 @@ MessageHandler::MessageHandler()
       task_running_(false),
       delete_me_(false),
       pool_(NULL),
+      last_worker_id_(0),
       start_callback_(NULL),
       end_callback_(NULL),
       callback_data_(0) {
@@ -79,6 +89,12 @@ MessageHandler::MessageHandler()
 }
 
 MessageHandler::~MessageHandler() {
+  Message* message = incoming_.exchange(nullptr);
+  while (message != nullptr) {
+    Message* next = message->next_;
+    delete message;
+    message = next;
+  }
   delete queue_;
   delete oob_queue_;
   queue_ = NULL;
@@ -131,46 +147,52 @@ bool MessageHandler::Run(ThreadPool* pool,
 
 void MessageHandler::PostMessage(std::unique_ptr<Message> message,
                                  bool before_events) {
-  Message::Priority saved_priority;
-
-  {
-    MonitorLocker ml(&monitor_);
-    if (FLAG_trace_isolates) {
-      Isolate* source_isolate = Isolate::Current();
-      if (source_isolate != nullptr) {
-        OS::PrintErr(
-            "[>] Posting message:\n"
-            "\tlen:        %" Pd "\n\tsource:     (%" Pd64
-            ") %s\n\tdest:       %s\n"
-            "\tdest_port:  %" Pd64 "\n",
-            message->Size(), static_cast<int64_t>(source_isolate->main_port()),
-            source_isolate->name(), name(), message->dest_port());
-      } else {
-        OS::PrintErr(
-            "[>] Posting message:\n"
-            "\tlen:        %" Pd
-            "\n\tsource:     <native code>\n"
-            "\tdest:       %s\n"
-            "\tdest_port:  %" Pd64 "\n",
-            message->Size(), name(), message->dest_port());
-      }
+  if (FLAG_trace_isolates) {
+    Isolate* source_isolate = Isolate::Current();
+    if (source_isolate != nullptr) {
+      OS::PrintErr(
+          "[>] Posting message:\n"
+          "\tlen:        %" Pd "\n\tsource:     (%" Pd64
+          ") %s\n\tdest:       %s\n"
+          "\tdest_port:  %" Pd64 "\n",
+          message->Size(), static_cast<int64_t>(source_isolate->main_port()),
+          source_isolate->name(), name(), message->dest_port());
+    } else {
+      OS::PrintErr(
+          "[>] Posting message:\n"
+          "\tlen:        %" Pd
+          "\n\tsource:     <native code>\n"
+          "\tdest:       %s\n"
+          "\tdest_port:  %" Pd64 "\n",
+          message->Size(), name(), message->dest_port());
     }
+  }
 
-    saved_priority = message->priority();
+  Message::Priority saved_priority = message->priority();
+  if (before_events) {
+    // Jumping ahead of the pending events needs the queues themselves.
+    MonitorLocker ml(&monitor_);
+    DrainIncomingLocked();
     if (message->IsOOB()) {
       oob_queue_->Enqueue(std::move(message), before_events);
     } else {
       queue_->Enqueue(std::move(message), before_events);
     }
-    if (paused_for_messages_) {
-      ml.Notify();
-    }
-
-    if (pool_ != nullptr && !task_running_) {
-      ASSERT(!delete_me_);
-      task_running_ = true;
-      const bool launched_successfully = pool_->Run<MessageHandlerTask>(this);
-      ASSERT(launched_successfully);
+    NotifyConsumerLocked(&ml);
+  } else {
+    Message* raw_message = message.release();
+    ASSERT(raw_message->next_ == nullptr);
+    Message* head = incoming_.load(std::memory_order_relaxed);
+    do {
+      raw_message->next_ = head;
+    } while (!incoming_.compare_exchange_weak(head, raw_message,
+                                              std::memory_order_release,
+                                              std::memory_order_relaxed));
+    // Messages posted while incoming_ is not empty are drained together with
+    // the one that made it non-empty, whose poster notifies the consumer.
+    if (head == nullptr) {
+      MonitorLocker ml(&monitor_);
+      NotifyConsumerLocked(&ml);
     }
   }
 
@@ -178,9 +200,50 @@ void MessageHandler::PostMessage(std::unique_ptr<Message> message,
   MessageNotify(saved_priority);
 }
 
+void MessageHandler::NotifyConsumerLocked(MonitorLocker* ml) {
+  if (paused_for_messages_) {
+    ml->Notify();
+  }
+
+  if (pool_ != nullptr && !task_running_) {
+    ASSERT(!delete_me_);
+    task_running_ = true;
+    const bool launched_successfully =
+        pool_->RunOnWorker<MessageHandlerTask>(last_worker_id_, this);
+    ASSERT(launched_successfully);
+  }
+}
+
+void MessageHandler::DrainIncomingLocked() {
+  ASSERT(monitor_.IsOwnedByCurrentThread());
+  if (incoming_.load(std::memory_order_relaxed) == nullptr) {
+    return;
+  }
+  Message* message = incoming_.exchange(nullptr, std::memory_order_acquire);
+  // Reverse the list to restore posting order.
+  Message* ordered = nullptr;
+  while (message != nullptr) {
+    Message* next = message->next_;
+    message->next_ = ordered;
+    ordered = message;
+    message = next;
+  }
+  while (ordered != nullptr) {
+    std::unique_ptr<Message> next_message(ordered);
+    ordered = ordered->next_;
+    next_message->next_ = nullptr;
+    if (next_message->IsOOB()) {
+      oob_queue_->Enqueue(std::move(next_message), false);
+    } else {
+      queue_->Enqueue(std::move(next_message), false);
+    }
+  }
+}
+
 std::unique_ptr<Message> MessageHandler::DequeueMessage(
     Message::Priority min_priority) {
   // TODO(turnidge): Add assert that monitor_ is held here.
+  DrainIncomingLocked();
   std::unique_ptr<Message> message = oob_queue_->Dequeue();
   if ((message == nullptr) && (min_priority < Message::kOOBPriority)) {
     message = queue_->Dequeue();
@@ -188,6 +251,46 @@ std::unique_ptr<Message> MessageHandler::DequeueMessage(
   return message;
 }
 
+bool MessageHandler::IsBatchable(const Message& message) {
+  return (message.priority() == Message::kNormalPriority) &&
+         (message.dest_port() != Message::kIllegalPort) &&
+         !message.IsFinalizerInvocationRequest() &&
+         (message.Size() <= kMaxBatchedMessageSize);
+}
+
+std::unique_ptr<Message> MessageHandler::DequeueBatchedMessage(
+    intptr_t batched) {
+  if (batched >= FLAG_message_batch_size) {
+    return nullptr;
+  }
+  MonitorLocker ml(&monitor_);
+  DrainIncomingLocked();
+  // OOB messages, pauses and messages posted before events all have to be
+  // seen by HandleMessages before the next normal message.
+  if (paused() || !oob_queue_->IsEmpty()) {
+    return nullptr;
+  }
+  Message* next = queue_->Peek();
+  if ((next == nullptr) || !IsBatchable(*next)) {
+    return nullptr;
+  }
+  return queue_->Dequeue();
+}
+
+MessageHandler::MessageStatus MessageHandler::HandleMessageBatch(
+    std::unique_ptr<Message> message) {
+  MessageStatus status = kOK;
+  intptr_t batched = 0;
+  while (message != nullptr) {
+    status = HandleMessage(std::move(message));
+    if (status != kOK) {
+      break;
+    }
+    message = DequeueBatchedMessage(++batched);
+  }
+  return status;
+}
+
 void MessageHandler::ClearOOBQueue() {
   oob_queue_->Clear();
 }
@@ -237,7 +340,11 @@ MessageHandler::MessageStatus MessageHandler::HandleMessages(
     MessageStatus status = kOK;
     {
       DisableIdleTimerScope disable_idle_timer(idle_time_handler);
-      status = HandleMessage(std::move(message));
+      if (allow_multiple_normal_messages && IsBatchable(*message)) {
+        status = HandleMessageBatch(std::move(message));
+      } else {
+        status = HandleMessage(std::move(message));
+      }
     }
     if (status > max_status) {
       max_status = status;
@@ -310,6 +417,7 @@ MessageHandler::MessageStatus MessageHandler::PauseAndHandleAllMessages(
   CheckAccess();
 #endif
   paused_for_messages_ = true;
+  DrainIncomingLocked();
   while (queue_->IsEmpty() && oob_queue_->IsEmpty()) {
     Monitor::WaitResult wr;
     {
@@ -318,6 +426,7 @@ MessageHandler::MessageStatus MessageHandler::PauseAndHandleAllMessages(
       TransitionVMToNative transition(Thread::Current());
       wr = ml.Wait(timeout_millis);
     }
+    DrainIncomingLocked();
     ASSERT(task_running_);
     ASSERT(!delete_me_);
     if (wr == Monitor::kTimedOut) {
@@ -375,11 +484,13 @@ bool MessageHandler::ShouldPauseOnExit(MessageStatus status) const {
 
 bool MessageHandler::HasOOBMessages() {
   MonitorLocker ml(&monitor_);
+  DrainIncomingLocked();
   return !oob_queue_->IsEmpty();
 }
 
 bool MessageHandler::HasMessages() {
   MonitorLocker ml(&monitor_);
+  DrainIncomingLocked();
   return !queue_->IsEmpty();
 }
 
@@ -401,6 +512,7 @@ void MessageHandler::TaskCallback() {
     // other message handler tasks will be started until this one sets
     // [task_running_] to false.
     ASSERT(task_running_);
+    last_worker_id_ = pool_->CurrentWorkerId();
 
 #if !defined(PRODUCT)
     if (ShouldPauseOnStart(kOK)) {
@@ -541,6 +653,7 @@ void MessageHandler::CloseAllPorts() {
         "\thandler:    %s\n",
         name());
   }
+  DrainIncomingLocked();
   queue_->Clear();
   oob_queue_->Clear();
 }
@@ -647,6 +760,7 @@ void MessageHandler::PausedOnExitLocked(MonitorLocker* ml, bool paused) {
 MessageHandler::AcquiredQueues::AcquiredQueues(MessageHandler* handler)
     : handler_(handler), ml_(&handler->monitor_) {
   ASSERT(handler != NULL);
+  handler_->DrainIncomingLocked();
   handler_->oob_message_handling_allowed_ = false;
 }
 
@@ -204,6 +204,20 @@ class MessageHandler {
   // Returns true on success.
   virtual MessageStatus HandleMessage(std::unique_ptr<Message> message) = 0;
 
+  // Handles a normal message followed by as many of the messages queued
+  // behind it as DequeueBatchedMessage hands out. Subclasses can override
+  // this to share per-message setup across the batch.
+  virtual MessageStatus HandleMessageBatch(std::unique_ptr<Message> message);
+
+  // Returns the next message of the batch started by HandleMessageBatch, or
+  // NULL if the batch has to end. A batch ends after [batched] reaches
+  // --message_batch_size or when the next message is not an ordinary message
+  // to a port, is large, or has to wait behind an OOB message or a pause.
+  std::unique_ptr<Message> DequeueBatchedMessage(intptr_t batched);
+
+  // Whether [message] can be handled as part of a message batch.
+  static bool IsBatchable(const Message& message);
+
   virtual void NotifyPauseOnStart() {}
   virtual void NotifyPauseOnExit() {}
 
@@ -242,6 +256,14 @@ class MessageHandler {
   // messages from the queue_.
   std::unique_ptr<Message> DequeueMessage(Message::Priority min_priority);
 
+  // Moves the messages posted to incoming_ into queue_ and oob_queue_, in the
+  // order in which they were posted.
+  void DrainIncomingLocked();
+
+  // Wakes up a thread waiting for messages and starts a task to handle them
+  // if none is running.
+  void NotifyConsumerLocked(MonitorLocker* ml);
+
   void ClearOOBQueue();
 
   // Handles any pending messages.
@@ -249,7 +271,12 @@ class MessageHandler {
                                bool allow_normal_messages,
                                bool allow_multiple_normal_messages);
 
-  Monitor monitor_;  // Protects all fields in MessageHandler.
+  Monitor monitor_;  // Protects all fields in MessageHandler but incoming_.
+  // Messages posted since the last DrainIncomingLocked, most recent first and
+  // linked through Message::next_. Posting pushes onto it without taking
+  // monitor_. Only the poster that finds it empty takes monitor_ to notify
+  // the consumer, which drains it whenever it looks at the queues.
+  AcqRelAtomic<Message*> incoming_;
   MessageQueue* queue_;
   MessageQueue* oob_queue_;
   // This flag is not thread safe and can only reliably be accessed on a single
@@ -270,6 +297,8 @@ class MessageHandler {
   bool task_running_;
   bool delete_me_;
   ThreadPool* pool_;
+  // The worker which last ran this handler, see [ThreadPool::RunOnWorker].
+  intptr_t last_worker_id_;
   StartCallback start_callback_;
   EndCallback end_callback_;
   CallbackData callback_data_;
@@ -10,6 +10,8 @@
 
 namespace dart {
 
+DECLARE_FLAG(int, message_batch_size);
+
 class MessageHandlerTestPeer {
  public:
   explicit MessageHandlerTestPeer(MessageHandler* handler)
@@ -24,10 +26,25 @@ class MessageHandlerTestPeer {
   void increment_live_ports() { handler_->increment_live_ports(); }
   void decrement_live_ports() { handler_->decrement_live_ports(); }
 
-  MessageQueue* queue() const { return handler_->queue_; }
-  MessageQueue* oob_queue() const { return handler_->oob_queue_; }
+  MessageQueue* queue() const {
+    DrainIncoming();
+    return handler_->queue_;
+  }
+  MessageQueue* oob_queue() const {
+    DrainIncoming();
+    return handler_->oob_queue_;
+  }
+  bool HasIncoming() const { return handler_->incoming_.load() != nullptr; }
+  std::unique_ptr<Message> DequeueBatchedMessage(intptr_t batched) {
+    return handler_->DequeueBatchedMessage(batched);
+  }
 
  private:
+  void DrainIncoming() const {
+    MonitorLocker ml(&handler_->monitor_);
+    handler_->DrainIncomingLocked();
+  }
+
   MessageHandler* handler_;
 
   DISALLOW_COPY_AND_ASSIGN(MessageHandlerTestPeer);
@@ -167,6 +184,58 @@ VM_UNIT_TEST_CASE(MessageHandler_PostMessage) {
   EXPECT(nullptr == handler_peer.queue()->Dequeue());
 }
 
+VM_UNIT_TEST_CASE(MessageHandler_PostMessageKeepsOrder) {
+  TestMessageHandler handler;
+  MessageHandlerTestPeer handler_peer(&handler);
+
+  std::unique_ptr<Message> message = BlankMessage(1, Message::kNormalPriority);
+  Message* raw_message1 = message.get();
+  handler_peer.PostMessage(std::move(message));
+  message = BlankMessage(2, Message::kOOBPriority);
+  Message* raw_message2 = message.get();
+  handler_peer.PostMessage(std::move(message));
+  message = BlankMessage(3, Message::kNormalPriority);
+  Message* raw_message3 = message.get();
+  handler_peer.PostMessage(std::move(message));
+
+  // Posting does not touch the queues until the handler looks at them.
+  EXPECT(handler_peer.HasIncoming());
+  EXPECT(raw_message1 == handler_peer.queue()->Dequeue().get());
+  EXPECT(!handler_peer.HasIncoming());
+  EXPECT(raw_message3 == handler_peer.queue()->Dequeue().get());
+  EXPECT(raw_message2 == handler_peer.oob_queue()->Dequeue().get());
+  EXPECT(nullptr == handler_peer.queue()->Dequeue());
+}
+
+VM_UNIT_TEST_CASE(MessageHandler_DequeueBatchedMessage) {
+  TestMessageHandler handler;
+  MessageHandlerTestPeer handler_peer(&handler);
+
+  std::unique_ptr<Message> message = BlankMessage(1, Message::kNormalPriority);
+  Message* raw_message1 = message.get();
+  handler_peer.PostMessage(std::move(message));
+  message = BlankMessage(Message::kIllegalPort, Message::kNormalPriority);
+  Message* raw_message2 = message.get();
+  handler_peer.PostMessage(std::move(message));
+  message = BlankMessage(3, Message::kNormalPriority);
+  Message* raw_message3 = message.get();
+  handler_peer.PostMessage(std::move(message));
+
+  // A message without a destination port ends the batch.
+  EXPECT(raw_message1 == handler_peer.DequeueBatchedMessage(0).get());
+  EXPECT(nullptr == handler_peer.DequeueBatchedMessage(1));
+  EXPECT(raw_message2 == handler_peer.queue()->Dequeue().get());
+
+  // So do pending OOB messages and a full batch.
+  handler_peer.PostMessage(BlankMessage(4, Message::kOOBPriority));
+  EXPECT(nullptr == handler_peer.DequeueBatchedMessage(0));
+  handler_peer.oob_queue()->Clear();
+  EXPECT(nullptr ==
+         handler_peer.DequeueBatchedMessage(FLAG_message_batch_size));
+  EXPECT(raw_message3 == handler_peer.DequeueBatchedMessage(0).get());
+  EXPECT(nullptr == handler_peer.DequeueBatchedMessage(0));
+}
+
 VM_UNIT_TEST_CASE(MessageHandler_HasOOBMessages) {
   TestMessageHandler handler;
   MessageHandlerTestPeer handler_peer(&handler);
@@ -3942,6 +3942,10 @@ ObjectPtr ReadObjectGraphCopyMessage(Thread* thread, PersistentHandle* handle) {
 ObjectPtr ReadMessage(Thread* thread, Message* message) {
   if (message->IsRaw()) {
     return message->raw_obj();
+  } else if (message->IsInt64()) {
+    return Integer::New(message->int64_value());
+  } else if (message->IsDouble()) {
+    return Double::New(message->double_value());
   } else if (message->IsFinalizerInvocationRequest()) {
     PersistentHandle* handle = message->persistent_handle();
     Object& msg_obj = Object::Handle(thread->zone(), handle->ptr());
@@ -3966,6 +3970,16 @@ Dart_CObject* ReadApiMessage(Zone* zone, Message* message) {
     Dart_CObject* result = zone->Alloc<Dart_CObject>(1);
     ApiObjectConverter::Convert(message->raw_obj(), result);
     return result;
+  } else if (message->IsInt64()) {
+    Dart_CObject* result = zone->Alloc<Dart_CObject>(1);
+    result->type = Dart_CObject_kInt64;
+    result->value.as_int64 = message->int64_value();
+    return result;
+  } else if (message->IsDouble()) {
+    Dart_CObject* result = zone->Alloc<Dart_CObject>(1);
+    result->type = Dart_CObject_kDouble;
+    result->value.as_double = message->double_value();
+    return result;
   } else {
     RELEASE_ASSERT(message->IsSnapshot());
     ApiMessageDeserializer deserializer(zone, message);
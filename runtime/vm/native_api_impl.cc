@@ -43,7 +43,41 @@ class IsolateLeaveScope {
   DISALLOW_COPY_AND_ASSIGN(IsolateLeaveScope);
 };
 
+// Messages consisting of a single primitive value are posted without writing
+// a snapshot: null, bools and Smis travel as raw objects, other integers and
+// doubles are boxed by the receiver.
+static std::unique_ptr<Message> NewPrimitiveMessage(Dart_Port port_id,
+                                                    Dart_CObject* message) {
+  switch (message->type) {
+    case Dart_CObject_kNull:
+      return Message::New(port_id, Object::null(), Message::kNormalPriority);
+    case Dart_CObject_kBool:
+      return Message::New(port_id, Bool::Get(message->value.as_bool).ptr(),
+                          Message::kNormalPriority);
+    case Dart_CObject_kInt32:
+    case Dart_CObject_kInt64: {
+      const int64_t value = message->type == Dart_CObject_kInt32
+                                ? message->value.as_int32
+                                : message->value.as_int64;
+      if (Smi::IsValid(value)) {
+        return Message::New(port_id, Smi::New(value), Message::kNormalPriority);
+      }
+      return Message::New(port_id, value, Message::kNormalPriority);
+    }
+    case Dart_CObject_kDouble:
+      return Message::New(port_id, message->value.as_double,
+                          Message::kNormalPriority);
+    default:
+      return nullptr;
+  }
+}
+
 static bool PostCObjectHelper(Dart_Port port_id, Dart_CObject* message) {
+  std::unique_ptr<Message> primitive = NewPrimitiveMessage(port_id, message);
+  if (primitive != nullptr) {
+    return PortMap::PostMessage(std::move(primitive));
+  }
+
   AllocOnlyStackZone zone;
   std::unique_ptr<Message> msg = WriteApiMessage(
       zone.GetZone(), message, port_id, Message::kNormalPriority);
@@ -65,10 +99,8 @@ DART_EXPORT bool Dart_PostInteger(Dart_Port port_id, int64_t message) {
     return PortMap::PostMessage(
         Message::New(port_id, Smi::New(message), Message::kNormalPriority));
   }
-  Dart_CObject cobj;
-  cobj.type = Dart_CObject_kInt64;
-  cobj.value.as_int64 = message;
-  return PostCObjectHelper(port_id, &cobj);
+  return PortMap::PostMessage(
+      Message::New(port_id, message, Message::kNormalPriority));
 }
 
 DART_EXPORT Dart_Port Dart_NewNativePort(const char* name,
@@ -630,7 +630,7 @@ class Object {
   };
 
  protected:
-  friend ObjectPtr AllocateObject(intptr_t, intptr_t);
+  friend ObjectPtr AllocateObject(intptr_t, intptr_t, Heap::Space);
 
   // Used for extracting the C++ vtable during bringup.
   Object() : ptr_(null_) {}
@@ -5914,6 +5914,13 @@ class PcDescriptors : public Object {
     return memcmp(untag(), other.untag(), InstanceSize(Length())) == 0;
   }
 
+  // Hashes the encoded descriptor bytes so that deduplication does not
+  // degenerate into linear probing when many tables share the same length.
+  uint32_t Hash() const {
+    NoSafepointScope no_safepoint;
+    return HashBytes(UnsafeMutableNonPointer(&untag()->data()[0]), Length());
+  }
+
  private:
   static const char* KindAsStr(UntaggedPcDescriptors::Kind kind);
 
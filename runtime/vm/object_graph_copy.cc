@@ -155,6 +155,10 @@ static bool CanShareObject(ObjectPtr obj, uword tags) {
   if (cid == kExternalTwoByteStringCid) return true;
   if (cid == kMintCid) return true;
   if (cid == kImmutableArrayCid) return true;
+  // Immutable maps and sets are either constants or the result of
+  // Isolate.freeze, which makes their contents deeply immutable.
+  if (cid == kImmutableLinkedHashMapCid) return true;
+  if (cid == kImmutableLinkedHashSetCid) return true;
   if (cid == kNeverCid) return true;
   if (cid == kSentinelCid) return true;
   if (cid == kStackTraceCid) return true;
@@ -204,6 +208,8 @@ static bool MightNeedReHashing(ObjectPtr object) {
   // a map or a value in a set, they will already have the identity hash code
   // set.
   if (cid == kImmutableArrayCid) return false;
+  if (cid == kImmutableLinkedHashMapCid) return false;
+  if (cid == kImmutableLinkedHashSetCid) return false;
   if (cid == kRegExpCid) return false;
   if (cid == kInt32x4Cid) return false;
 
@@ -251,13 +257,13 @@ void SetNewSpaceTaggingWord(ObjectPtr to, classid_t cid, uint32_t size) {
 }
 
 DART_FORCE_INLINE
-ObjectPtr AllocateObject(intptr_t cid, intptr_t size) {
+ObjectPtr AllocateObject(intptr_t cid, intptr_t size, Heap::Space space) {
 #if defined(DART_COMPRESSED_POINTERS)
   const bool compressed = true;
 #else
   const bool compressed = false;
 #endif
-  return Object::Allocate(cid, size, Heap::kNew, compressed);
+  return Object::Allocate(cid, size, space, compressed);
 }
 
 DART_FORCE_INLINE
@@ -537,6 +543,7 @@ class SlowForwardMap : public ForwardMapBase {
   }
 
  private:
+  friend class SlowObjectCopyBase;
   friend class SlowObjectCopy;
   friend class ObjectGraphCopier;
 
@@ -866,6 +873,20 @@ class SlowObjectCopyBase : public ObjectCopyBase {
       : ObjectCopyBase(thread), slow_forward_map_(thread) {}
 
  protected:
+  // The slow path is also taken when new space is merely full or a safepoint
+  // is requested, so copies start in new space. Once the copy is a large
+  // part of new space, the rest is allocated in old space, where scavenges
+  // would otherwise promote it anyway.
+  static constexpr intptr_t kOldSpaceCopyFraction = 4;
+
+  Heap::Space CopySpace() const {
+    const int64_t threshold_in_bytes =
+        new_space_->CapacityInWords() * kWordSize / kOldSpaceCopyFraction;
+    return slow_forward_map_.allocated_bytes > threshold_in_bytes
+               ? Heap::kOld
+               : Heap::kNew;
+  }
+
   DART_FORCE_INLINE
   void ForwardCompressedPointers(const Object& src,
                                  const Object& dst,
@@ -996,7 +1017,7 @@ class SlowObjectCopyBase : public ObjectCopyBase {
     if (size == 0) {
       size = from.ptr().untag()->HeapSize();
     }
-    to_ = AllocateObject(cid, size);
+    to_ = AllocateObject(cid, size, CopySpace());
     UpdateLengthField(cid, from.ptr(), to_.ptr());
     slow_forward_map_.Insert(from, to_, size);  // SAFEPOINT
     ObjectPtr to = to_.ptr();
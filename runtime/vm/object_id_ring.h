@@ -53,6 +53,9 @@ class ObjectIdRing {
 
   void PrintJSON(JSONStream* js);
 
+  // The size of the ring's backing store in bytes.
+  intptr_t SizeInBytes() const { return capacity_ * sizeof(ObjectPtr); }
+
  private:
   friend class ObjectIdRingTestHelper;
 
@@ -3031,6 +3031,30 @@ ISOLATE_UNIT_TEST_CASE(PcDescriptorsLargeDeltas) {
   EXPECT_EQ(false, iter.MoveNext());
 }
 
+ISOLATE_UNIT_TEST_CASE(PcDescriptorsHash) {
+  auto build = [&](intptr_t deopt_id) {
+    DescriptorList* builder = new DescriptorList(thread->zone());
+    builder->AddDescriptor(UntaggedPcDescriptors::kOther, 10, deopt_id,
+                           TokenPosition::Deserialize(20), 1, 1);
+    builder->AddDescriptor(UntaggedPcDescriptors::kDeopt, 20, deopt_id + 1,
+                           TokenPosition::Deserialize(30), 0, -1);
+    return builder->FinalizePcDescriptors(0);
+  };
+
+  const auto& a = PcDescriptors::Handle(build(1));
+  const auto& b = PcDescriptors::Handle(build(1));
+  const auto& c = PcDescriptors::Handle(build(2));
+
+  // Structurally equal descriptors must hash the same so they are dedupped.
+  EXPECT(a.ptr() != b.ptr());
+  EXPECT(a.Equals(b));
+  EXPECT_EQ(a.Hash(), b.Hash());
+
+  // Same length but different contents should not be equal.
+  EXPECT_EQ(a.Length(), c.Length());
+  EXPECT(!a.Equals(c));
+}
+
 static ClassPtr CreateTestClass(const char* name) {
   const String& class_name =
       String::Handle(Symbols::New(Thread::Current(), name));
@@ -63,6 +63,11 @@ class OS {
   // NOTE: This function will return -1 on OSs that are not supported.
   static int64_t GetCurrentThreadCPUMicros();
 
+  // Stores the number of minor and major page faults incurred by the current
+  // process so far in |minor| and |major|.
+  // NOTE: This function will return false on OSs that are not supported.
+  static bool GetPageFaultCounts(int64_t* minor, int64_t* major);
+
   // If the tracing/timeline configuration on takes timestamps as input, returns
   // the same value as |GetCurrentMonotonicMicros|. Otherwise, returns -1.
   static int64_t GetCurrentMonotonicMicrosForTimeline();
@@ -178,6 +178,16 @@ int64_t OS::GetCurrentThreadCPUMicros() {
   return result;
 }
 
+bool OS::GetPageFaultCounts(int64_t* minor, int64_t* major) {
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0) {
+    return false;
+  }
+  *minor = usage.ru_minflt;
+  *major = usage.ru_majflt;
+  return true;
+}
+
 int64_t OS::GetCurrentMonotonicMicrosForTimeline() {
 #if defined(SUPPORT_TIMELINE)
   if (Timeline::recorder_discards_clock_values()) return -1;
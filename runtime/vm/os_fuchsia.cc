@@ -453,6 +453,10 @@ int64_t OS::GetCurrentThreadCPUMicros() {
   return status == ZX_OK ? info.total_runtime / kNanosecondsPerMicrosecond : 0;
 }
 
+bool OS::GetPageFaultCounts(int64_t* minor, int64_t* major) {
+  return false;
+}
+
 int64_t OS::GetCurrentMonotonicMicrosForTimeline() {
 #if defined(SUPPORT_TIMELINE)
   return OS::GetCurrentMonotonicMicros();
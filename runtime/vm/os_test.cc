@@ -7,6 +7,7 @@
 #include "platform/utils.h"
 #include "vm/globals.h"
 #include "vm/unit_test.h"
+#include "vm/virtual_memory.h"
 
 namespace dart {
 
@@ -32,4 +33,31 @@ VM_UNIT_TEST_CASE(OsFuncs) {
   EXPECT_LE(1, procs);
 }
 
+VM_UNIT_TEST_CASE(PageFaultCounts) {
+  int64_t minor_before, major_before;
+  if (!OS::GetPageFaultCounts(&minor_before, &major_before)) {
+    return;  // Not supported on this OS.
+  }
+  // The first write to each page of a fresh mapping faults it in.
+  const intptr_t kPageCount = 256;
+  const intptr_t page_size = VirtualMemory::PageSize();
+  VirtualMemory* memory =
+      VirtualMemory::Allocate(kPageCount * page_size, /*is_executable=*/false,
+                              /*is_compressed=*/false, "page-fault-test");
+  ASSERT(memory != nullptr);
+  uint8_t* start = reinterpret_cast<uint8_t*>(memory->address());
+  for (intptr_t i = 0; i < kPageCount; i++) {
+    start[i * page_size] = static_cast<uint8_t>(i);
+  }
+  int64_t minor_after, major_after;
+  EXPECT(OS::GetPageFaultCounts(&minor_after, &major_after));
+  delete memory;
+  EXPECT_LE(minor_before, minor_after);
+  EXPECT_LE(major_before, major_after);
+  // Allow for pages the OS faults in ahead of time (e.g. fault-around or
+  // transparent huge pages), but most pages must have been counted.
+  EXPECT_LE(kPageCount / 4, (minor_after - minor_before) +
+                                (major_after - major_before));
+}
+
 }  // namespace dart
@@ -218,6 +218,14 @@ class OSThread : public BaseThread {
   static ThreadId ThreadIdFromIntPtr(intptr_t id);
   static bool Compare(ThreadId a, ThreadId b);
 
+  // Restricts the current thread to run on the given CPU. Returns false if
+  // this is not supported by the OS or failed.
+  static bool SetCurrentThreadAffinity(intptr_t cpu);
+
+  // Returns the CPU at index n modulo the number of CPUs the process may run
+  // on, counting in ascending order, or -1 if the OS does not report them.
+  static intptr_t NthAllowedCpu(intptr_t n);
+
   // This function can be called only once per OSThread, and should only be
   // called when the retunred id will eventually be passed to OSThread::Join().
   static ThreadJoinId GetCurrentThreadJoinId(OSThread* thread);
@@ -7,10 +7,12 @@
 #if defined(DART_USE_ABSL)
 
 #include <errno.h>  // NOLINT
+#include <sched.h>  // NOLINT
 #include <stdio.h>
 #include <sys/resource.h>  // NOLINT
 #include <sys/syscall.h>   // NOLINT
 #include <sys/time.h>      // NOLINT
+#include <unistd.h>        // NOLINT
 
 #include "platform/address_sanitizer.h"
 #include "platform/assert.h"
@@ -268,6 +270,38 @@ bool OSThread::Compare(ThreadId a, ThreadId b) {
   return pthread_equal(a, b) != 0;
 }
 
+bool OSThread::SetCurrentThreadAffinity(intptr_t cpu) {
+  if (cpu < 0 || cpu >= CPU_SETSIZE) {
+    return false;
+  }
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(cpu, &set);
+  return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+}
+
+intptr_t OSThread::NthAllowedCpu(intptr_t n) {
+  // Use the mask of the main thread, which is the process' mask unless the
+  // embedder changed it. Threads inherit the mask of the thread that starts
+  // them, so the mask of a pinned worker only holds its own CPU.
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  if (sched_getaffinity(getpid(), sizeof(set), &set) != 0) {
+    return -1;
+  }
+  const intptr_t count = CPU_COUNT(&set);
+  if (count == 0) {
+    return -1;
+  }
+  n %= count;
+  for (intptr_t cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+    if (CPU_ISSET(cpu, &set) && (n-- == 0)) {
+      return cpu;
+    }
+  }
+  return -1;
+}
+
 bool OSThread::GetCurrentStackBounds(uword* lower, uword* upper) {
 #if defined(DART_HOST_OS_ANDROID) || defined(DART_HOST_OS_LINUX)
   pthread_attr_t attr;
@@ -9,9 +9,11 @@
 #include "vm/os_thread.h"
 
 #include <errno.h>  // NOLINT
+#include <sched.h>  // NOLINT
 #include <stdio.h>
 #include <sys/resource.h>  // NOLINT
 #include <sys/time.h>      // NOLINT
+#include <unistd.h>        // NOLINT
 
 #include "platform/address_sanitizer.h"
 #include "platform/assert.h"
@@ -248,6 +250,38 @@ bool OSThread::Compare(ThreadId a, ThreadId b) {
   return a == b;
 }
 
+bool OSThread::SetCurrentThreadAffinity(intptr_t cpu) {
+  if (cpu < 0 || cpu >= CPU_SETSIZE) {
+    return false;
+  }
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(cpu, &set);
+  return sched_setaffinity(0, sizeof(set), &set) == 0;
+}
+
+intptr_t OSThread::NthAllowedCpu(intptr_t n) {
+  // Use the mask of the main thread, which is the process' mask unless the
+  // embedder changed it. Threads inherit the mask of the thread that starts
+  // them, so the mask of a pinned worker only holds its own CPU.
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  if (sched_getaffinity(getpid(), sizeof(set), &set) != 0) {
+    return -1;
+  }
+  const intptr_t count = CPU_COUNT(&set);
+  if (count == 0) {
+    return -1;
+  }
+  n %= count;
+  for (intptr_t cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+    if (CPU_ISSET(cpu, &set) && (n-- == 0)) {
+      return cpu;
+    }
+  }
+  return -1;
+}
+
 bool OSThread::GetCurrentStackBounds(uword* lower, uword* upper) {
   pthread_attr_t attr;
   if (pthread_getattr_np(pthread_self(), &attr) != 0) {
@@ -203,6 +203,16 @@ bool OSThread::Compare(ThreadId a, ThreadId b) {
   return pthread_equal(a, b) != 0;
 }
 
+bool OSThread::SetCurrentThreadAffinity(intptr_t cpu) {
+  // Not supported.
+  return false;
+}
+
+intptr_t OSThread::NthAllowedCpu(intptr_t n) {
+  // Not supported.
+  return -1;
+}
+
 bool OSThread::GetCurrentStackBounds(uword* lower, uword* upper) {
   pthread_attr_t attr;
   if (pthread_getattr_np(pthread_self(), &attr) != 0) {
@@ -227,6 +227,16 @@ bool OSThread::Compare(ThreadId a, ThreadId b) {
   return pthread_equal(a, b) != 0;
 }
 
+bool OSThread::SetCurrentThreadAffinity(intptr_t cpu) {
+  // Not supported.
+  return false;
+}
+
+intptr_t OSThread::NthAllowedCpu(intptr_t n) {
+  // Not supported.
+  return -1;
+}
+
 bool OSThread::GetCurrentStackBounds(uword* lower, uword* upper) {
   *upper = reinterpret_cast<uword>(pthread_get_stackaddr_np(pthread_self()));
   *lower = *upper - pthread_get_stacksize_np(pthread_self());
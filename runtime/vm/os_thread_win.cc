@@ -171,6 +171,39 @@ bool OSThread::Compare(ThreadId a, ThreadId b) {
   return a == b;
 }
 
+bool OSThread::SetCurrentThreadAffinity(intptr_t cpu) {
+  const intptr_t kMaxCpus = sizeof(DWORD_PTR) * kBitsPerByte;
+  if (cpu < 0 || cpu >= kMaxCpus) {
+    return false;
+  }
+  const DWORD_PTR mask = static_cast<DWORD_PTR>(1) << cpu;
+  return SetThreadAffinityMask(GetCurrentThread(), mask) != 0;
+}
+
+intptr_t OSThread::NthAllowedCpu(intptr_t n) {
+  DWORD_PTR process_mask;
+  DWORD_PTR system_mask;
+  if (!GetProcessAffinityMask(GetCurrentProcess(), &process_mask,
+                              &system_mask)) {
+    return -1;
+  }
+  const intptr_t kMaxCpus = sizeof(DWORD_PTR) * kBitsPerByte;
+  intptr_t count = 0;
+  for (intptr_t cpu = 0; cpu < kMaxCpus; cpu++) {
+    if (((process_mask >> cpu) & 1) != 0) count++;
+  }
+  if (count == 0) {
+    return -1;
+  }
+  n %= count;
+  for (intptr_t cpu = 0; cpu < kMaxCpus; cpu++) {
+    if ((((process_mask >> cpu) & 1) != 0) && (n-- == 0)) {
+      return cpu;
+    }
+  }
+  return -1;
+}
+
 bool OSThread::GetCurrentStackBounds(uword* lower, uword* upper) {
   // On Windows stack limits for the current thread are available in
   // the thread information block (TIB).
@@ -174,6 +174,17 @@ int64_t OS::GetCurrentThreadCPUMicros() {
   return -1;
 }
 
+bool OS::GetPageFaultCounts(int64_t* minor, int64_t* major) {
+  PROCESS_MEMORY_COUNTERS pmc;
+  if (!GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc))) {
+    return false;
+  }
+  // Windows does not distinguish between soft and hard faults here.
+  *minor = pmc.PageFaultCount;
+  *major = 0;
+  return true;
+}
+
 int64_t OS::GetCurrentMonotonicMicrosForTimeline() {
 #if defined(SUPPORT_TIMELINE)
   return OS::GetCurrentMonotonicMicros();
@@ -18,7 +18,7 @@
 namespace dart {
 
 Mutex* PortMap::mutex_ = NULL;
-PortSet<PortMap::Entry>* PortMap::ports_ = NULL;
+PortMap::Shard PortMap::shards_[PortMap::kNumShards];
 MessageHandler* PortMap::deleted_entry_ = reinterpret_cast<MessageHandler*>(1);
 Random* PortMap::prng_ = NULL;
 
@@ -62,21 +62,23 @@ Dart_Port PortMap::AllocatePort() {
     }
 
     ASSERT(!static_cast<ObjectPtr>(static_cast<uword>(result))->IsWellFormed());
-  } while (ports_->Contains(result));
+  } while (ShardFor(result)->ports->Contains(result));
 
   ASSERT(result != 0);
-  ASSERT(!ports_->Contains(result));
+  ASSERT(!ShardFor(result)->ports->Contains(result));
   return result;
 }
 
 void PortMap::SetPortState(Dart_Port port, PortState state) {
   MutexLocker ml(mutex_);
-  if (ports_ == nullptr) {
+  Shard* shard = ShardFor(port);
+  MutexLocker shard_locker(shard->mutex);
+  if (shard->ports == nullptr) {
     return;
   }
 
-  auto it = ports_->TryLookup(port);
-  ASSERT(it != ports_->end());
+  auto it = shard->ports->TryLookup(port);
+  ASSERT(it != shard->ports->end());
 
   Entry& entry = *it;
   PortState old_state = entry.state;
@@ -99,7 +101,7 @@ void PortMap::SetPortState(Dart_Port port, PortState state) {
 Dart_Port PortMap::CreatePort(MessageHandler* handler) {
   ASSERT(handler != NULL);
   MutexLocker ml(mutex_);
-  if (ports_ == nullptr) {
+  if (shards_[0].ports == nullptr) {
     return ILLEGAL_PORT;
   }
 
@@ -119,7 +121,11 @@ Dart_Port PortMap::CreatePort(MessageHandler* handler) {
   entry.port = port;
   entry.handler = handler;
   entry.state = kNewPort;
-  ports_->Insert(entry);
+  {
+    Shard* shard = ShardFor(port);
+    MutexLocker shard_locker(shard->mutex);
+    shard->ports->Insert(entry);
+  }
 
   if (FLAG_trace_isolates) {
     OS::PrintErr(
@@ -136,11 +142,13 @@ bool PortMap::ClosePort(Dart_Port port) {
   MessageHandler* handler = NULL;
   {
     MutexLocker ml(mutex_);
-    if (ports_ == nullptr) {
+    Shard* shard = ShardFor(port);
+    MutexLocker shard_locker(shard->mutex);
+    if (shard->ports == nullptr) {
       return false;
     }
-    auto it = ports_->TryLookup(port);
-    if (it == ports_->end()) {
+    auto it = shard->ports->TryLookup(port);
+    if (it == shard->ports->end()) {
       return false;
     }
     Entry entry = *it;
@@ -158,7 +166,7 @@ bool PortMap::ClosePort(Dart_Port port) {
     // Delete the port entry before releasing the lock to avoid holding the lock
     // while flushing the messages below.
     it.Delete();
-    ports_->Rebalance();
+    shard->ports->Rebalance();
 
     // The MessageHandler::ports_ is only accessed by [PortMap], it is guarded
     // by the [PortMap::mutex_] we already hold.
@@ -178,15 +186,17 @@ bool PortMap::ClosePort(Dart_Port port) {
 void PortMap::ClosePorts(MessageHandler* handler) {
   {
     MutexLocker ml(mutex_);
-    if (ports_ == nullptr) {
+    if (shards_[0].ports == nullptr) {
       return;
     }
     // The MessageHandler::ports_ is only accessed by [PortMap], it is guarded
     // by the [PortMap::mutex_] we already hold.
     for (auto isolate_it = handler->ports_.begin();
          isolate_it != handler->ports_.end(); ++isolate_it) {
-      auto it = ports_->TryLookup((*isolate_it).port);
-      ASSERT(it != ports_->end());
+      Shard* shard = ShardFor((*isolate_it).port);
+      MutexLocker shard_locker(shard->mutex);
+      auto it = shard->ports->TryLookup((*isolate_it).port);
+      ASSERT(it != shard->ports->end());
       Entry entry = *it;
       ASSERT(entry.port == (*isolate_it).port);
       ASSERT(entry.handler == handler);
@@ -195,21 +205,22 @@ void PortMap::ClosePorts(MessageHandler* handler) {
       }
       it.Delete();
       isolate_it.Delete();
+      shard->ports->Rebalance();
     }
     ASSERT(handler->ports_.IsEmpty());
-    ports_->Rebalance();
   }
   handler->CloseAllPorts();
 }
 
 bool PortMap::PostMessage(std::unique_ptr<Message> message,
                           bool before_events) {
-  MutexLocker ml(mutex_);
-  if (ports_ == nullptr) {
+  Shard* shard = ShardFor(message->dest_port());
+  MutexLocker ml(shard->mutex);
+  if (shard->ports == nullptr) {
     return false;
   }
-  auto it = ports_->TryLookup(message->dest_port());
-  if (it == ports_->end()) {
+  auto it = shard->ports->TryLookup(message->dest_port());
+  if (it == shard->ports->end()) {
     // Ownership of external data remains with the poster.
     message->DropFinalizers();
     return false;
@@ -221,12 +232,13 @@ bool PortMap::PostMessage(std::unique_ptr<Message> message,
 }
 
 bool PortMap::IsLocalPort(Dart_Port id) {
-  MutexLocker ml(mutex_);
-  if (ports_ == nullptr) {
+  Shard* shard = ShardFor(id);
+  MutexLocker ml(shard->mutex);
+  if (shard->ports == nullptr) {
     return false;
   }
-  auto it = ports_->TryLookup(id);
-  if (it == ports_->end()) {
+  auto it = shard->ports->TryLookup(id);
+  if (it == shard->ports->end()) {
     // Port does not exist.
     return false;
   }
@@ -237,12 +249,13 @@ bool PortMap::IsLocalPort(Dart_Port id) {
 }
 
 bool PortMap::IsLivePort(Dart_Port id) {
-  MutexLocker ml(mutex_);
-  if (ports_ == nullptr) {
+  Shard* shard = ShardFor(id);
+  MutexLocker ml(shard->mutex);
+  if (shard->ports == nullptr) {
     return false;
   }
-  auto it = ports_->TryLookup(id);
-  if (it == ports_->end()) {
+  auto it = shard->ports->TryLookup(id);
+  if (it == shard->ports->end()) {
     // Port does not exist.
     return false;
   }
@@ -252,12 +265,13 @@ bool PortMap::IsLivePort(Dart_Port id) {
 }
 
 Isolate* PortMap::GetIsolate(Dart_Port id) {
-  MutexLocker ml(mutex_);
-  if (ports_ == nullptr) {
+  Shard* shard = ShardFor(id);
+  MutexLocker ml(shard->mutex);
+  if (shard->ports == nullptr) {
     return nullptr;
   }
-  auto it = ports_->TryLookup(id);
-  if (it == ports_->end()) {
+  auto it = shard->ports->TryLookup(id);
+  if (it == shard->ports->end()) {
     // Port does not exist.
     return nullptr;
   }
@@ -268,12 +282,13 @@ Isolate* PortMap::GetIsolate(Dart_Port id) {
 
 bool PortMap::IsReceiverInThisIsolateGroup(Dart_Port receiver,
                                            IsolateGroup* group) {
-  MutexLocker ml(mutex_);
-  if (ports_ == nullptr) {
+  Shard* shard = ShardFor(receiver);
+  MutexLocker ml(shard->mutex);
+  if (shard->ports == nullptr) {
     return false;
   }
-  auto it = ports_->TryLookup(receiver);
-  if (it == ports_->end()) return false;
+  auto it = shard->ports->TryLookup(receiver);
+  if (it == shard->ports->end()) return false;
   auto isolate = (*it).handler->isolate();
   if (isolate == nullptr) return false;
   return isolate->group() == group;
@@ -287,31 +302,44 @@ void PortMap::Init() {
   if (prng_ == nullptr) {
     prng_ = new Random();
   }
-  if (ports_ == nullptr) {
-    ports_ = new PortSet<Entry>();
+  for (intptr_t i = 0; i < kNumShards; i++) {
+    Shard* shard = &shards_[i];
+    if (shard->mutex == nullptr) {
+      shard->mutex = new Mutex();
+    }
+    if (shard->ports == nullptr) {
+      shard->ports = new PortSet<Entry>();
+    }
   }
 }
 
 void PortMap::Cleanup() {
-  ASSERT(ports_ != nullptr);
   ASSERT(prng_ != NULL);
-  for (auto it = ports_->begin(); it != ports_->end(); ++it) {
-    const auto& entry = *it;
-    ASSERT(entry.handler != nullptr);
-    if (entry.state == kLivePort) {
-      entry.handler->decrement_live_ports();
+  for (intptr_t i = 0; i < kNumShards; i++) {
+    PortSet<Entry>* ports = shards_[i].ports;
+    ASSERT(ports != nullptr);
+    for (auto it = ports->begin(); it != ports->end(); ++it) {
+      const auto& entry = *it;
+      ASSERT(entry.handler != nullptr);
+      if (entry.state == kLivePort) {
+        entry.handler->decrement_live_ports();
+      }
+      delete entry.handler;
+      it.Delete();
     }
-    delete entry.handler;
-    it.Delete();
+    ports->Rebalance();
   }
-  ports_->Rebalance();
 
-  // Grab the mutex and delete the port set.
+  // Grab the mutexes and delete the port sets. The mutexes themselves stay
+  // alive, like mutex_, for lookups racing with shutdown.
   MutexLocker ml(mutex_);
   delete prng_;
   prng_ = NULL;
-  delete ports_;
-  ports_ = nullptr;
+  for (intptr_t i = 0; i < kNumShards; i++) {
+    MutexLocker shard_locker(shards_[i].mutex);
+    delete shards_[i].ports;
+    shards_[i].ports = nullptr;
+  }
 }
 
 void PortMap::PrintPortsForMessageHandler(MessageHandler* handler,
@@ -322,18 +350,22 @@ void PortMap::PrintPortsForMessageHandler(MessageHandler* handler,
   Object& msg_handler = Object::Handle();
   {
     JSONArray ports(&jsobj, "ports");
+    // Holding mutex_ is enough to iterate the shards, as every change to
+    // them requires it.
     SafepointMutexLocker ml(mutex_);
-    if (ports_ == nullptr) {
+    if (shards_[0].ports == nullptr) {
       return;
     }
-    for (auto& entry : *ports_) {
-      if (entry.handler == handler) {
-        if (entry.state == kLivePort) {
-          JSONObject port(&ports);
-          port.AddProperty("type", "_Port");
-          port.AddPropertyF("name", "Isolate Port (%" Pd64 ")", entry.port);
-          msg_handler = DartLibraryCalls::LookupHandler(entry.port);
-          port.AddProperty("handler", msg_handler);
+    for (intptr_t i = 0; i < kNumShards; i++) {
+      for (auto& entry : *shards_[i].ports) {
+        if (entry.handler == handler) {
+          if (entry.state == kLivePort) {
+            JSONObject port(&ports);
+            port.AddProperty("type", "_Port");
+            port.AddPropertyF("name", "Isolate Port (%" Pd64 ")", entry.port);
+            msg_handler = DartLibraryCalls::LookupHandler(entry.port);
+            port.AddProperty("handler", msg_handler);
+          }
         }
       }
     }
@@ -343,16 +375,18 @@ void PortMap::PrintPortsForMessageHandler(MessageHandler* handler,
 
 void PortMap::DebugDumpForMessageHandler(MessageHandler* handler) {
   SafepointMutexLocker ml(mutex_);
-  if (ports_ == nullptr) {
+  if (shards_[0].ports == nullptr) {
     return;
   }
   Object& msg_handler = Object::Handle();
-  for (auto& entry : *ports_) {
-    if (entry.handler == handler) {
-      if (entry.state == kLivePort) {
-        OS::PrintErr("Live Port = %" Pd64 "\n", entry.port);
-        msg_handler = DartLibraryCalls::LookupHandler(entry.port);
-        OS::PrintErr("Handler = %s\n", msg_handler.ToCString());
+  for (intptr_t i = 0; i < kNumShards; i++) {
+    for (auto& entry : *shards_[i].ports) {
+      if (entry.handler == handler) {
+        if (entry.state == kLivePort) {
+          OS::PrintErr("Live Port = %" Pd64 "\n", entry.port);
+          msg_handler = DartLibraryCalls::LookupHandler(entry.port);
+          OS::PrintErr("Handler = %s\n", msg_handler.ToCString());
+        }
       }
     }
   }
@@ -85,15 +85,33 @@ class PortMap : public AllStatic {
     PortState state;
   };
 
+  // The port map is split into shards by port id, so that looking up the
+  // receiver of a message only contends with lookups of ports in the same
+  // shard. Adding, removing or updating an entry requires both mutex_ and
+  // the mutex of its shard, reading an entry requires either of them.
+  static constexpr intptr_t kNumShards = 32;
+  // Port ids have 52 random bits. The shard is chosen by the highest ones,
+  // as the lowest ones pick the slot inside the shard's PortSet.
+  static constexpr intptr_t kShardShift = 47;
+
+  struct Shard {
+    Mutex* mutex = nullptr;
+    PortSet<Entry>* ports = nullptr;
+  };
+
+  static Shard* ShardFor(Dart_Port port) {
+    return &shards_[(static_cast<uint64_t>(port) >> kShardShift) % kNumShards];
+  }
+
   static const char* PortStateString(PortState state);
 
   // Allocate a new unique port.
   static Dart_Port AllocatePort();
 
-  // Lock protecting access to the port map.
+  // Lock serializing all changes to the port map.
   static Mutex* mutex_;
 
-  static PortSet<Entry>* ports_;
+  static Shard shards_[kNumShards];
   static MessageHandler* deleted_entry_;
 
   static Random* prng_;
@@ -16,18 +16,26 @@ class PortMapTestPeer {
  public:
   static bool IsActivePort(Dart_Port port) {
     MutexLocker ml(PortMap::mutex_);
-    auto it = PortMap::ports_->TryLookup(port);
-    return it != PortMap::ports_->end();
+    auto ports = PortMap::ShardFor(port)->ports;
+    auto it = ports->TryLookup(port);
+    return it != ports->end();
   }
 
   static bool IsLivePort(Dart_Port port) {
     MutexLocker ml(PortMap::mutex_);
-    auto it = PortMap::ports_->TryLookup(port);
-    if (it == PortMap::ports_->end()) {
+    auto ports = PortMap::ShardFor(port)->ports;
+    auto it = ports->TryLookup(port);
+    if (it == ports->end()) {
       return false;
     }
     return (*it).state == PortMap::kLivePort;
   }
+
+  static intptr_t NumShards() { return PortMap::kNumShards; }
+
+  static intptr_t ShardIndex(Dart_Port port) {
+    return PortMap::ShardFor(port) - PortMap::shards_;
+  }
 };
 
 class PortTestMessageHandler : public MessageHandler {
@@ -93,6 +101,32 @@ TEST_CASE(PortMap_CreateManyPorts) {
   }
 }
 
+TEST_CASE(PortMap_ShardedPorts) {
+  PortTestMessageHandler handler;
+  const intptr_t kNumPorts = 256;
+  Dart_Port ports[kNumPorts];
+  bool used_shards[64] = {};
+  ASSERT(PortMapTestPeer::NumShards() <= 64);
+  for (intptr_t i = 0; i < kNumPorts; i++) {
+    ports[i] = PortMap::CreatePort(&handler);
+    used_shards[PortMapTestPeer::ShardIndex(ports[i])] = true;
+  }
+  intptr_t used_shard_count = 0;
+  for (intptr_t i = 0; i < PortMapTestPeer::NumShards(); i++) {
+    if (used_shards[i]) used_shard_count++;
+  }
+  // Random port ids spread over the shards.
+  EXPECT(used_shard_count > PortMapTestPeer::NumShards() / 2);
+
+  for (intptr_t i = 0; i < kNumPorts; i++) {
+    EXPECT(PortMapTestPeer::IsActivePort(ports[i]));
+  }
+  PortMap::ClosePorts(&handler);
+  for (intptr_t i = 0; i < kNumPorts; i++) {
+    EXPECT(!PortMapTestPeer::IsActivePort(ports[i]));
+  }
+}
+
 TEST_CASE(PortMap_SetPortState) {
   PortTestMessageHandler handler;
 
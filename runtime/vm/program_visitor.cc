@@ -736,9 +736,13 @@ class PcDescriptorsKeyValueTrait {
 
   static Value ValueOf(Pair kv) { return kv; }
 
-  static inline uword Hash(Key key) { return Utils::WordHash(key->Length()); }
+  static inline uword Hash(Key key) {
+    ASSERT(!key->IsNull());
+    return Utils::WordHash(key->Hash());
+  }
 
   static inline bool IsKeyEqual(Pair pair, Key key) {
+    ASSERT(!pair->IsNull() && !key->IsNull());
     return pair->Equals(*key);
   }
 };
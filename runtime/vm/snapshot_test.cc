@@ -1972,6 +1972,48 @@ VM_UNIT_TEST_CASE(PostCObject) {
   Dart_ExitScope();
 }
 
+VM_UNIT_TEST_CASE(PostCObjectInt64) {
+  TestIsolateScope __test_isolate__;
+  const char* kScriptChars =
+      "import 'dart:isolate';\n"
+      "main() {\n"
+      "  var messages = [];\n"
+      "  var port = new RawReceivePort();\n"
+      "  port.handler = (message) {\n"
+      "    messages.add(message);\n"
+      "    if (messages.length == 3) throw new Exception(messages);\n"
+      "  };\n"
+      "  return port.sendPort;\n"
+      "}\n";
+  Dart_Handle lib = TestCase::LoadTestScript(kScriptChars, NULL);
+  Dart_EnterScope();
+
+  Dart_Handle send_port = Dart_Invoke(lib, NewString("main"), 0, NULL);
+  EXPECT_VALID(send_port);
+  Dart_Port port_id;
+  Dart_Handle result = Dart_SendPortGetId(send_port, &port_id);
+  ASSERT(!Dart_IsError(result));
+
+  // Values outside of the Smi range are boxed by the receiver.
+  Dart_CObject object;
+  object.type = Dart_CObject_kInt64;
+  object.value.as_int64 = kMaxInt64;
+  EXPECT(Dart_PostCObject(port_id, &object));
+  object.value.as_int64 = kMinInt64;
+  EXPECT(Dart_PostCObject(port_id, &object));
+  EXPECT(Dart_PostInteger(port_id, DART_INT64_C(0x100000000000)));
+
+  result = Dart_RunLoop();
+  EXPECT(Dart_IsError(result));
+  EXPECT(Dart_ErrorHasException(result));
+  EXPECT_SUBSTRING(
+      "Exception: [9223372036854775807, -9223372036854775808, "
+      "17592186044416]\n",
+      Dart_GetError(result));
+
+  Dart_ExitScope();
+}
+
 TEST_CASE(IsKernelNegative) {
   EXPECT(!Dart_IsKernel(NULL, 0));
 
@@ -4,9 +4,11 @@
 
 #include "vm/thread_pool.h"
 
+#include "platform/atomic.h"
 #include "vm/dart.h"
 #include "vm/flags.h"
 #include "vm/lockers.h"
+#include "vm/os.h"
 
 namespace dart {
 
@@ -14,6 +16,25 @@ DEFINE_FLAG(int,
             worker_timeout_millis,
             5000,
             "Free workers when they have been idle for this amount of time.");
+DEFINE_FLAG(bool,
+            worker_affinity,
+            false,
+            "Prefer running message handlers on the worker that ran them "
+            "last, so they find their data in that core's caches.");
+DEFINE_FLAG(bool,
+            pin_worker_threads,
+            false,
+            "Pin each thread pool worker to a CPU, assigned round robin.");
+DEFINE_FLAG(bool,
+            worker_local_tasks,
+            false,
+            "Keep the last task scheduled by a worker for that worker to run "
+            "next, so it finds its data in that core's caches.");
+DEFINE_FLAG(int,
+            worker_steal_delay_micros,
+            100,
+            "Let other workers take a task kept for a busy worker only after "
+            "it has waited this long for that worker.");
 
 static int64_t ComputeTimeout(int64_t idle_start) {
   int64_t worker_timeout_micros =
@@ -81,14 +102,21 @@ void ThreadPool::Shutdown() {
   ASSERT(dead_workers_.IsEmpty());
 }
 
-bool ThreadPool::RunImpl(std::unique_ptr<Task> task) {
+bool ThreadPool::RunImpl(std::unique_ptr<Task> task,
+                         intptr_t preferred_worker_id) {
+  auto current_worker =
+      static_cast<Worker*>(OSThread::Current()->owning_thread_pool_worker_);
+  if (current_worker != nullptr && current_worker->pool_ != this) {
+    current_worker = nullptr;
+  }
   Worker* new_worker = nullptr;
   {
     MonitorLocker ml(&pool_monitor_);
     if (shutting_down_) {
       return false;
     }
-    new_worker = ScheduleTaskLocked(&ml, std::move(task));
+    new_worker = ScheduleTaskLocked(&ml, current_worker, preferred_worker_id,
+                                    std::move(task));
   }
   if (new_worker != nullptr) {
     new_worker->StartThread();
@@ -96,6 +124,18 @@ bool ThreadPool::RunImpl(std::unique_ptr<Task> task) {
   return true;
 }
 
+intptr_t ThreadPool::CurrentWorkerId() {
+  auto worker =
+      static_cast<Worker*>(OSThread::Current()->owning_thread_pool_worker_);
+  return worker != nullptr && worker->pool_ == this ? worker->id_ : 0;
+}
+
+bool ThreadPool::WorkerIsWaitingForTesting(intptr_t worker_id) {
+  MonitorLocker ml(&pool_monitor_);
+  Worker* worker = FindWorkerLocked(&idle_workers_, worker_id);
+  return worker != nullptr && worker->is_waiting_;
+}
+
 bool ThreadPool::CurrentThreadIsWorker() {
   auto worker =
       static_cast<Worker*>(OSThread::Current()->owning_thread_pool_worker_);
@@ -110,16 +150,23 @@ void ThreadPool::MarkCurrentWorkerAsBlocked() {
     MonitorLocker ml(&pool_monitor_);
     ASSERT(!worker->is_blocked_);
     worker->is_blocked_ = true;
+    // A blocked worker won't get to the task it reserved for itself any time
+    // soon, so hand it to the other workers.
+    if (worker->pool_ == this && worker->next_task_ != nullptr) {
+      tasks_.Append(worker->next_task_);
+      worker->next_task_ = nullptr;
+      if (count_idle_ > reserved_tasks_) {
+        NotifyIdleWorkerLocked(&ml);
+      }
+    }
     if (max_pool_size_ > 0) {
       ++max_pool_size_;
       // This thread is blocked and therefore no longer usable as a worker.
       // If we have pending tasks and there are no idle workers, we will spawn a
       // new thread (temporarily allow exceeding the maximum pool size) to
       // handle the pending tasks.
-      if (idle_workers_.IsEmpty() && pending_tasks_ > 0) {
-        new_worker = new Worker(this);
-        idle_workers_.Append(new_worker);
-        count_idle_++;
+      if (count_idle_ == reserved_tasks_ && TasksWaitingToRunLocked()) {
+        new_worker = NewWorkerLocked();
       }
     }
   }
@@ -149,23 +196,31 @@ void ThreadPool::WorkerLoop(Worker* worker) {
   while (true) {
     MonitorLocker ml(&pool_monitor_);
 
-    if (!tasks_.IsEmpty()) {
+    // An idle worker only has a task of its own if it was reserved for it.
+    if (worker->next_task_ != nullptr) {
+      ASSERT(reserved_tasks_ > 0);
+      reserved_tasks_--;
+    }
+    std::unique_ptr<Task> task(TakeTaskLocked(worker));
+    if (task != nullptr) {
       IdleToRunningLocked(worker);
-      while (!tasks_.IsEmpty()) {
-        std::unique_ptr<Task> task(tasks_.RemoveFirst());
+      while (task != nullptr) {
         pending_tasks_--;
-        MonitorLeaveScope mls(&ml);
-        task->Run();
-        ASSERT(Isolate::Current() == nullptr);
-        task.reset();
+        {
+          MonitorLeaveScope mls(&ml);
+          task->Run();
+          ASSERT(Isolate::Current() == nullptr);
+          task.reset();
+        }
+        task.reset(TakeTaskLocked(worker));
       }
       RunningToIdleLocked(worker);
     }
 
     if (running_workers_.IsEmpty()) {
-      ASSERT(tasks_.IsEmpty());
+      ASSERT(pending_tasks_ == reserved_tasks_);
       OnEnterIdleLocked(&ml);
-      if (!tasks_.IsEmpty()) {
+      if (TasksWaitingToRunLocked()) {
         continue;
       }
     }
@@ -176,20 +231,33 @@ void ThreadPool::WorkerLoop(Worker* worker) {
       break;
     }
 
-    // Sleep until we get a new task, we time out or we're shutdown.
+    // Sleep until we get a new task, we time out or we're shutdown. If busy
+    // workers have tasks parked that we may not steal yet, wake up when the
+    // first of them can be stolen.
     const int64_t idle_start = OS::GetCurrentMonotonicMicros();
     bool done = false;
+    worker->is_waiting_ = true;
     while (!done) {
-      const auto result = ml.WaitMicros(ComputeTimeout(idle_start));
+      int64_t timeout = ComputeTimeout(idle_start);
+      const int64_t steal_time = NextStealTimeLocked();
+      const bool wait_for_steal = steal_time != 0;
+      if (wait_for_steal) {
+        const int64_t until_steal = Utils::Maximum<int64_t>(
+            steal_time - OS::GetCurrentMonotonicMicros(), 1);
+        timeout = timeout == 0 ? until_steal
+                               : Utils::Minimum(timeout, until_steal);
+      }
+      const auto result = ml.WaitMicros(timeout);
 
       // We have to drain all pending tasks.
-      if (!tasks_.IsEmpty()) break;
+      if (worker->next_task_ != nullptr || TasksWaitingToRunLocked()) break;
 
-      if (shutting_down_ || result == Monitor::kTimedOut) {
+      if (shutting_down_ || (result == Monitor::kTimedOut && !wait_for_steal)) {
         done = true;
         break;
       }
     }
+    worker->is_waiting_ = false;
     if (done) {
       ObtainDeadWorkersLocked(&dead_workers_to_join);
       IdleToDeadLocked(worker);
@@ -213,7 +281,9 @@ void ThreadPool::IdleToRunningLocked(Worker* worker) {
 }
 
 void ThreadPool::RunningToIdleLocked(Worker* worker) {
-  ASSERT(tasks_.IsEmpty());
+  // Other busy workers might still have tasks parked which we were not
+  // allowed to steal yet.
+  ASSERT(worker->next_task_ == nullptr);
 
   ASSERT(running_workers_.ContainsForDebugging(worker));
   running_workers_.Remove(worker);
@@ -223,7 +293,8 @@ void ThreadPool::RunningToIdleLocked(Worker* worker) {
 }
 
 void ThreadPool::IdleToDeadLocked(Worker* worker) {
-  ASSERT(tasks_.IsEmpty());
+  ASSERT(pending_tasks_ == reserved_tasks_);
+  ASSERT(worker->next_task_ == nullptr);
 
   ASSERT(idle_workers_.ContainsForDebugging(worker));
   idle_workers_.Remove(worker);
@@ -259,17 +330,131 @@ void ThreadPool::JoinDeadWorkersLocked(WorkerList* dead_workers_to_join) {
   ASSERT(dead_workers_to_join->IsEmpty());
 }
 
+ThreadPool::Task* ThreadPool::TakeTaskLocked(Worker* worker) {
+  // Prefer the task this worker scheduled for itself.
+  Task* task = worker->next_task_;
+  if (task != nullptr) {
+    worker->next_task_ = nullptr;
+    return task;
+  }
+
+  if (!tasks_.IsEmpty()) {
+    return tasks_.RemoveFirst();
+  }
+
+  // Steal from workers that are still busy with their current task, but only
+  // once the task has waited [FLAG_worker_steal_delay_micros] for them: the
+  // owner usually gets to it well before that, with a warm cache. When
+  // shutting down, the remaining tasks are drained by whoever is around.
+  int64_t now = 0;
+  for (Worker* victim : running_workers_) {
+    task = victim->next_task_;
+    if (task == nullptr) continue;
+    if (!shutting_down_) {
+      if (now == 0) now = OS::GetCurrentMonotonicMicros();
+      if (now < victim->next_task_steal_time_) continue;
+    }
+    victim->next_task_ = nullptr;
+    return task;
+  }
+  return nullptr;
+}
+
+int64_t ThreadPool::NextStealTimeLocked() {
+  int64_t steal_time = 0;
+  for (Worker* worker : running_workers_) {
+    if (worker->next_task_ != nullptr &&
+        (steal_time == 0 || worker->next_task_steal_time_ < steal_time)) {
+      steal_time = worker->next_task_steal_time_;
+    }
+  }
+  return steal_time;
+}
+
+ThreadPool::Worker* ThreadPool::FindWorkerLocked(WorkerList* list,
+                                                 intptr_t id) {
+  for (Worker* worker : *list) {
+    if (worker->id_ == id) {
+      return worker;
+    }
+  }
+  return nullptr;
+}
+
+void ThreadPool::NotifyIdleWorkerLocked(MonitorLocker* ml) {
+  // A plain notification might wake up a worker which only takes the task
+  // reserved for it.
+  if (reserved_tasks_ > 0) {
+    ml->NotifyAll();
+  } else {
+    ml->Notify();
+  }
+}
+
+ThreadPool::Worker* ThreadPool::NewWorkerLocked() {
+  auto new_worker = new Worker(this, next_worker_id_++);
+  idle_workers_.Append(new_worker);
+  count_idle_++;
+  return new_worker;
+}
+
 ThreadPool::Worker* ThreadPool::ScheduleTaskLocked(MonitorLocker* ml,
+                                                   Worker* current_worker,
+                                                   intptr_t preferred_worker_id,
                                                    std::unique_ptr<Task> task) {
-  // Enqueue the new task.
-  tasks_.Append(task.release());
   pending_tasks_++;
   ASSERT(pending_tasks_ >= 1);
 
+  Worker* target = FLAG_worker_local_tasks ? current_worker : nullptr;
+  if (FLAG_worker_affinity && preferred_worker_id != 0) {
+    // Hand the task directly to the preferred worker if it is waiting for
+    // work. The other idle workers leave reserved tasks alone.
+    Worker* preferred = FindWorkerLocked(&idle_workers_, preferred_worker_id);
+    if (preferred != nullptr && preferred->is_waiting_ &&
+        preferred->next_task_ == nullptr) {
+      preferred->next_task_ = task.release();
+      reserved_tasks_++;
+      ml->NotifyAll();
+      return nullptr;
+    }
+    // If it is busy, it will run the task next unless it gets stolen.
+    preferred = FindWorkerLocked(&running_workers_, preferred_worker_id);
+    if (preferred != nullptr) {
+      target = preferred;
+    }
+  }
+
+  // Enqueue the new task. Tasks for a busy worker are kept local to that
+  // worker (LIFO), pushing out any task it had reserved before to the shared
+  // queue (FIFO). All other tasks go to the shared queue. Without
+  // --worker_local_tasks or --worker_affinity nothing is kept local, so idle
+  // workers never wait for a steal time.
+  if (target != nullptr && !target->is_blocked_) {
+    ASSERT(running_workers_.ContainsForDebugging(target));
+    Task* displaced = target->next_task_;
+    target->next_task_ = task.release();
+    target->next_task_steal_time_ =
+        OS::GetCurrentMonotonicMicros() + FLAG_worker_steal_delay_micros;
+    if (displaced == nullptr) {
+      // Nothing is ready for other workers yet. One idle worker is enough to
+      // steal the parked task should the owner take too long (e.g. because it
+      // waits for the task to finish), so only start a new worker if there is
+      // none.
+      if (count_idle_ > reserved_tasks_) {
+        NotifyIdleWorkerLocked(ml);
+        return nullptr;
+      }
+    } else {
+      tasks_.Append(displaced);
+    }
+  } else {
+    tasks_.Append(task.release());
+  }
+
   // Notify existing idle worker (if available).
   if (count_idle_ >= pending_tasks_) {
     ASSERT(!idle_workers_.IsEmpty());
-    ml->Notify();
+    NotifyIdleWorkerLocked(ml);
     return nullptr;
   }
 
@@ -277,20 +462,17 @@ ThreadPool::Worker* ThreadPool::ScheduleTaskLocked(MonitorLocker* ml,
   // new one.
   if (max_pool_size_ > 0 && (count_idle_ + count_running_) >= max_pool_size_) {
     if (!idle_workers_.IsEmpty()) {
-      ml->Notify();
+      NotifyIdleWorkerLocked(ml);
     }
     return nullptr;
   }
 
   // Otherwise start a new worker.
-  auto new_worker = new Worker(this);
-  idle_workers_.Append(new_worker);
-  count_idle_++;
-  return new_worker;
+  return NewWorkerLocked();
 }
 
-ThreadPool::Worker::Worker(ThreadPool* pool)
-    : pool_(pool), join_id_(OSThread::kInvalidThreadJoinId) {}
+ThreadPool::Worker::Worker(ThreadPool* pool, intptr_t id)
+    : pool_(pool), id_(id), join_id_(OSThread::kInvalidThreadJoinId) {}
 
 void ThreadPool::Worker::StartThread() {
   int result = OSThread::Start("DartWorker", &Worker::Main,
@@ -317,6 +499,16 @@ void ThreadPool::Worker::Main(uword args) {
   os_thread->owning_thread_pool_worker_ = worker;
   worker->os_thread_ = os_thread;
 
+  if (FLAG_pin_worker_threads) {
+    // Round robin over the CPUs the process may run on, which are not
+    // necessarily the first NumberOfAvailableProcessors() ones.
+    static RelaxedAtomic<intptr_t> next_cpu = 0;
+    const intptr_t cpu = OSThread::NthAllowedCpu(next_cpu.fetch_add(1));
+    if ((cpu < 0) || !OSThread::SetCurrentThreadAffinity(cpu)) {
+      OS::PrintErr("Failed to pin worker thread to CPU %" Pd "\n", cpu);
+    }
+  }
+
   // Once the worker quits it needs to be joined.
   worker->join_id_ = OSThread::GetCurrentThreadJoinId(os_thread);
 
@@ -46,6 +46,19 @@ class ThreadPool {
     return RunImpl(std::unique_ptr<Task>(new T(std::forward<Args>(args)...)));
   }
 
+  // Runs a task on the thread pool, preferably on the worker with the given
+  // id (see [CurrentWorkerId]) if --worker_affinity is enabled. The id is
+  // only a hint: the worker might be busy or gone already.
+  template <typename T, typename... Args>
+  bool RunOnWorker(intptr_t worker_id, Args&&... args) {
+    return RunImpl(std::unique_ptr<Task>(new T(std::forward<Args>(args)...)),
+                   worker_id);
+  }
+
+  // Returns the id of the worker the current thread belongs to, or 0 if the
+  // current thread is not a worker of [this] thread pool. Ids are not reused.
+  intptr_t CurrentWorkerId();
+
   // Returns `true` if the current thread is runing on the [this] thread pool.
   bool CurrentThreadIsWorker();
 
@@ -65,11 +78,13 @@ class ThreadPool {
   uint64_t workers_started() const { return count_idle_ + count_running_; }
   // Exposed for unit test in thread_pool_test.cc
   uint64_t workers_stopped() const { return count_dead_; }
+  // Exposed for unit test in thread_pool_test.cc
+  bool WorkerIsWaitingForTesting(intptr_t worker_id);
 
  private:
   class Worker : public IntrusiveDListEntry<Worker> {
    public:
-    explicit Worker(ThreadPool* pool);
+    Worker(ThreadPool* pool, intptr_t id);
 
     // Starts the thread for the worker.  This should only be called
     // after a task has been set by the initial call to SetTask().
@@ -84,9 +99,27 @@ class ThreadPool {
     // Fields initialized during construction or in start of main function of
     // thread.
     ThreadPool* pool_;
+    const intptr_t id_;
     ThreadJoinId join_id_;
     OSThread* os_thread_ = nullptr;
     bool is_blocked_ = false;
+    // Whether the worker is idle and waiting for new tasks.
+    bool is_waiting_ = false;
+
+    // A task scheduled by this worker while it was running. The worker runs
+    // it next, before looking at the shared queue, so that e.g. a message
+    // handler woken up by a message sent from this worker starts on a warm
+    // cache. Idle workers steal it if the owner is still busy at
+    // [next_task_steal_time_].
+    //
+    // It is also used to hand a task to a specific idle worker (see
+    // [ThreadPool::RunOnWorker]). Such reserved tasks are not stolen.
+    //
+    // Only accessed while holding [ThreadPool::pool_monitor_].
+    Task* next_task_ = nullptr;
+    // When other workers may steal [next_task_] (see
+    // [FLAG_worker_steal_delay_micros]).
+    int64_t next_task_steal_time_ = 0;
 
     DISALLOW_COPY_AND_ASSIGN(Worker);
   };
@@ -101,17 +134,27 @@ class ThreadPool {
   // Whether a shutdown was requested.
   bool ShuttingDownLocked() { return shutting_down_; }
 
-  // Whether new tasks are ready to be run.
-  bool TasksWaitingToRunLocked() { return !tasks_.IsEmpty(); }
+  // Whether new tasks are ready to be run by any worker.
+  bool TasksWaitingToRunLocked() { return pending_tasks_ > reserved_tasks_; }
 
  private:
   using TaskList = IntrusiveDList<Task>;
   using WorkerList = IntrusiveDList<Worker>;
 
-  bool RunImpl(std::unique_ptr<Task> task);
+  bool RunImpl(std::unique_ptr<Task> task, intptr_t preferred_worker_id = 0);
   void WorkerLoop(Worker* worker);
 
-  Worker* ScheduleTaskLocked(MonitorLocker* ml, std::unique_ptr<Task> task);
+  Worker* ScheduleTaskLocked(MonitorLocker* ml,
+                             Worker* current_worker,
+                             intptr_t preferred_worker_id,
+                             std::unique_ptr<Task> task);
+  Task* TakeTaskLocked(Worker* worker);
+  // The earliest time a task parked by a running worker may be stolen, or 0
+  // if there is none.
+  int64_t NextStealTimeLocked();
+  Worker* FindWorkerLocked(WorkerList* list, intptr_t id);
+  void NotifyIdleWorkerLocked(MonitorLocker* ml);
+  Worker* NewWorkerLocked();
 
   void IdleToRunningLocked(Worker* worker);
   void RunningToIdleLocked(Worker* worker);
@@ -128,7 +171,10 @@ class ThreadPool {
   WorkerList idle_workers_;
   WorkerList dead_workers_;
   uint64_t pending_tasks_ = 0;
+  // Pending tasks which are reserved for a particular idle worker.
+  uint64_t reserved_tasks_ = 0;
   TaskList tasks_;
+  intptr_t next_worker_id_ = 1;
 
   Monitor exit_monitor_;
   std::atomic<bool> all_workers_dead_;
@@ -9,6 +9,9 @@
 
 namespace dart {
 
+DECLARE_FLAG(bool, worker_affinity);
+DECLARE_FLAG(bool, worker_local_tasks);
+DECLARE_FLAG(int, worker_steal_delay_micros);
 DECLARE_FLAG(int, worker_timeout_millis);
 
 // Some of these tests change VM flags, so they should run without a full VM
@@ -256,4 +259,257 @@ THREAD_POOL_UNIT_TEST_CASE(ThreadPool_RecursiveSpawn) {
   EXPECT_EQ(kTotalTasks, done);
 }
 
+class RecordingTask : public ThreadPool::Task {
+ public:
+  RecordingTask(Monitor* sync, int id, int* order, int* count)
+      : sync_(sync), id_(id), order_(order), count_(count) {}
+
+  virtual void Run() {
+    MonitorLocker ml(sync_);
+    order_[(*count_)++] = id_;
+    ml.Notify();
+  }
+
+ private:
+  Monitor* sync_;
+  int id_;
+  int* order_;
+  int* count_;
+};
+
+class ScheduleLocalTask : public ThreadPool::Task {
+ public:
+  ScheduleLocalTask(ThreadPool* pool,
+                    Monitor* sync,
+                    int* order,
+                    int* count,
+                    bool wait)
+      : pool_(pool), sync_(sync), order_(order), count_(count), wait_(wait) {}
+
+  virtual void Run() {
+    pool_->Run<RecordingTask>(sync_, 1, order_, count_);
+    if (wait_) {
+      // Only another worker can run the task we just scheduled.
+      MonitorLocker ml(sync_);
+      while (*count_ < 1) {
+        ml.Wait();
+      }
+      return;
+    }
+    pool_->Run<RecordingTask>(sync_, 2, order_, count_);
+  }
+
+ private:
+  ThreadPool* pool_;
+  Monitor* sync_;
+  int* order_;
+  int* count_;
+  bool wait_;
+};
+
+THREAD_POOL_UNIT_TEST_CASE(ThreadPool_LocalTaskRunsFirst) {
+  const bool saved_local_tasks = FLAG_worker_local_tasks;
+  FLAG_worker_local_tasks = true;
+  {
+    ThreadPool thread_pool(/*max_pool_size=*/1);
+    Monitor sync;
+    int order[2] = {0, 0};
+    int count = 0;
+    thread_pool.Run<ScheduleLocalTask>(&thread_pool, &sync, order, &count,
+                                       /*wait=*/false);
+    {
+      MonitorLocker ml(&sync);
+      while (count < 2) {
+        ml.Wait();
+      }
+    }
+    // The most recently scheduled task is run first by the same worker, the
+    // one it displaced went to the shared queue.
+    EXPECT_EQ(2, order[0]);
+    EXPECT_EQ(1, order[1]);
+    EXPECT_EQ(1U, thread_pool.workers_started());
+  }
+  FLAG_worker_local_tasks = saved_local_tasks;
+}
+
+THREAD_POOL_UNIT_TEST_CASE(ThreadPool_NoLocalTasks) {
+  const bool saved_local_tasks = FLAG_worker_local_tasks;
+  FLAG_worker_local_tasks = false;
+  {
+    ThreadPool thread_pool(/*max_pool_size=*/1);
+    Monitor sync;
+    int order[2] = {0, 0};
+    int count = 0;
+    thread_pool.Run<ScheduleLocalTask>(&thread_pool, &sync, order, &count,
+                                       /*wait=*/false);
+    {
+      MonitorLocker ml(&sync);
+      while (count < 2) {
+        ml.Wait();
+      }
+    }
+    // Without local tasks, tasks scheduled by a worker run in order.
+    EXPECT_EQ(1, order[0]);
+    EXPECT_EQ(2, order[1]);
+  }
+  FLAG_worker_local_tasks = saved_local_tasks;
+}
+
+THREAD_POOL_UNIT_TEST_CASE(ThreadPool_StealLocalTask) {
+  const bool saved_local_tasks = FLAG_worker_local_tasks;
+  FLAG_worker_local_tasks = true;
+  {
+    ThreadPool thread_pool;
+    Monitor sync;
+    int order[1] = {0};
+    int count = 0;
+    thread_pool.Run<ScheduleLocalTask>(&thread_pool, &sync, order, &count,
+                                       /*wait=*/true);
+    {
+      MonitorLocker ml(&sync);
+      while (count < 1) {
+        ml.Wait();
+      }
+    }
+    EXPECT_EQ(1, order[0]);
+    EXPECT_EQ(2U, thread_pool.workers_started());
+  }
+  FLAG_worker_local_tasks = saved_local_tasks;
+}
+
+class WorkerIdTask : public ThreadPool::Task {
+ public:
+  WorkerIdTask(ThreadPool* pool,
+               Monitor* sync,
+               intptr_t* worker_id,
+               int* count,
+               int wait_for)
+      : pool_(pool),
+        sync_(sync),
+        worker_id_(worker_id),
+        count_(count),
+        wait_for_(wait_for) {}
+
+  virtual void Run() {
+    MonitorLocker ml(sync_);
+    *worker_id_ = pool_->CurrentWorkerId();
+    (*count_)++;
+    ml.NotifyAll();
+    // Keep this worker busy until [wait_for_] tasks run at the same time.
+    while (*count_ < wait_for_) {
+      ml.Wait();
+    }
+  }
+
+ private:
+  ThreadPool* pool_;
+  Monitor* sync_;
+  intptr_t* worker_id_;
+  int* count_;
+  int wait_for_;
+};
+
+THREAD_POOL_UNIT_TEST_CASE(ThreadPool_RunOnWorker) {
+  const bool saved_affinity = FLAG_worker_affinity;
+  const int saved_timeout = FLAG_worker_timeout_millis;
+  FLAG_worker_affinity = true;
+  // Keep the workers around however long the test takes.
+  FLAG_worker_timeout_millis = 0;
+  {
+    const int kWorkerCount = 4;
+    ThreadPool thread_pool;
+    Monitor sync;
+    intptr_t worker_ids[kWorkerCount];
+    int count = 0;
+    for (int i = 0; i < kWorkerCount; i++) {
+      thread_pool.Run<WorkerIdTask>(&thread_pool, &sync, &worker_ids[i],
+                                    &count, kWorkerCount);
+    }
+    {
+      MonitorLocker ml(&sync);
+      while (count < kWorkerCount) {
+        ml.Wait();
+      }
+    }
+    EXPECT_EQ(0, thread_pool.CurrentWorkerId());
+
+    for (int i = 0; i < kWorkerCount; i++) {
+      EXPECT_NE(0, worker_ids[i]);
+      // Tasks are only handed to a worker which is waiting for work.
+      while (!thread_pool.WorkerIsWaitingForTesting(worker_ids[i])) {
+        OS::Sleep(1);
+      }
+      intptr_t ran_on = 0;
+      int ran_count = 0;
+      thread_pool.RunOnWorker<WorkerIdTask>(worker_ids[i], &thread_pool, &sync,
+                                            &ran_on, &ran_count, 1);
+      {
+        MonitorLocker ml(&sync);
+        while (ran_count < 1) {
+          ml.Wait();
+        }
+      }
+      EXPECT_EQ(worker_ids[i], ran_on);
+    }
+  }
+  FLAG_worker_affinity = saved_affinity;
+  FLAG_worker_timeout_millis = saved_timeout;
+}
+
+class ScheduleAndSleepTask : public ThreadPool::Task {
+ public:
+  ScheduleAndSleepTask(ThreadPool* pool,
+                       Monitor* sync,
+                       intptr_t* owner_id,
+                       intptr_t* ran_on,
+                       int* count)
+      : pool_(pool),
+        sync_(sync),
+        owner_id_(owner_id),
+        ran_on_(ran_on),
+        count_(count) {}
+
+  virtual void Run() {
+    *owner_id_ = pool_->CurrentWorkerId();
+    pool_->Run<WorkerIdTask>(pool_, sync_, ran_on_, count_, 1);
+    // Stay busy for a bit, a second worker is started meanwhile.
+    OS::Sleep(20);
+  }
+
+ private:
+  ThreadPool* pool_;
+  Monitor* sync_;
+  intptr_t* owner_id_;
+  intptr_t* ran_on_;
+  int* count_;
+};
+
+THREAD_POOL_UNIT_TEST_CASE(ThreadPool_LocalTaskNotStolenEarly) {
+  const bool saved_local_tasks = FLAG_worker_local_tasks;
+  const int saved_delay = FLAG_worker_steal_delay_micros;
+  FLAG_worker_local_tasks = true;
+  FLAG_worker_steal_delay_micros = 10 * kMicrosecondsPerSecond;
+  {
+    ThreadPool thread_pool;
+    Monitor sync;
+    intptr_t owner_id = 0;
+    intptr_t ran_on = 0;
+    int count = 0;
+    thread_pool.Run<ScheduleAndSleepTask>(&thread_pool, &sync, &owner_id,
+                                          &ran_on, &count);
+    {
+      MonitorLocker ml(&sync);
+      while (count < 1) {
+        ml.Wait();
+      }
+    }
+    // The idle worker was not allowed to take the task before its owner was
+    // done.
+    EXPECT_NE(0, owner_id);
+    EXPECT_EQ(owner_id, ran_on);
+  }
+  FLAG_worker_local_tasks = saved_local_tasks;
+  FLAG_worker_steal_delay_micros = saved_delay;
+}
+
 }  // namespace dart
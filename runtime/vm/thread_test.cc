@@ -712,6 +712,24 @@ ISOLATE_UNIT_TEST_CASE(ThreadIterator_Count) {
   EXPECT(thread_count_0 >= thread_count_1);
 }
 
+VM_UNIT_TEST_CASE(OSThread_NthAllowedCpu) {
+  const intptr_t first = OSThread::NthAllowedCpu(0);
+  if (first < 0) {
+    return;  // Not supported.
+  }
+  // The allowed CPUs are listed in ascending order, then wrap around.
+  intptr_t previous = first;
+  intptr_t count = 1;
+  for (; count < 64 * KB; count++) {
+    const intptr_t cpu = OSThread::NthAllowedCpu(count);
+    if (cpu == first) break;
+    EXPECT(cpu > previous);
+    previous = cpu;
+  }
+  EXPECT(count <= OS::NumberOfAvailableProcessors());
+  EXPECT_EQ(previous, OSThread::NthAllowedCpu(2 * count - 1));
+}
+
 ISOLATE_UNIT_TEST_CASE(ThreadIterator_FindSelf) {
   OSThread* current = OSThread::Current();
   EXPECT(OSThread::IsThreadInList(current->id()));
@@ -81,6 +81,9 @@ class Isolate {
   @patch
   static Never exit([SendPort? finalMessagePort, Object? message]) =>
       _unsupported();
+
+  @patch
+  static T freeze<T>(T object) => _unsupported();
 }
 
 /** Default factory for receive ports. */
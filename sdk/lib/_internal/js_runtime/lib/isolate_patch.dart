@@ -111,6 +111,11 @@ class Isolate {
   static Never exit([SendPort? finalMessagePort, Object? message]) {
     throw new UnsupportedError("Isolate.exit");
   }
+
+  @patch
+  static T freeze<T>(T object) {
+    throw new UnsupportedError("Isolate.freeze");
+  }
 }
 
 @patch
@@ -107,6 +107,12 @@ class _RandomAccessFileOpsImpl extends NativeFieldWrapperClass1
   external flush();
   @pragma("vm:external-name", "File_Lock")
   external lock(int lock, int start, int end);
+  @pragma("vm:external-name", "File_Map")
+  external map(int type, int position, int length);
+  @pragma("vm:external-name", "File_MapAdvise")
+  external mapAdvise(Uint8List mapping, int offset, int length, int advice);
+  @pragma("vm:external-name", "File_MapSync")
+  external mapSync(Uint8List mapping, int offset, int length);
 }
 
 class _WatcherPath {
@@ -10,6 +10,16 @@ class _FilterImpl extends NativeFieldWrapperClass1 implements RawZLibFilter {
 
   @pragma("vm:external-name", "Filter_Processed")
   external List<int>? processed({bool flush: true, bool end: false});
+
+  List<int> _processAll(List<int> data, int start, int end) {
+    _BufferAndStart bufferAndStart =
+        _ensureFastAndSerializableByteData(data, start, end);
+    return _processAllNative(bufferAndStart.buffer, bufferAndStart.start,
+        end - (start - bufferAndStart.start));
+  }
+
+  @pragma("vm:external-name", "Filter_ProcessAll")
+  external List<int> _processAllNative(List<int> data, int start, int end);
 }
 
 class _ZLibInflateFilter extends _FilterImpl {
@@ -481,6 +481,13 @@ class _NativeSocket extends _NativeSocketNativeWrapper with _ServiceObject {
   // Only used for UDP sockets.
   bool _availableDatagram = false;
 
+  // Only used for UDP sockets. Once more than one datagram is queued,
+  // [receive] reads them in batches into [_datagrams] and hands them out
+  // one by one, starting with the one at [_nextDatagram]. The batch is
+  // dropped again once no more datagrams are queued.
+  _DatagramBatch? _datagrams;
+  int _nextDatagram = 0;
+
   // The number of incoming connnections for Listening socket.
   int connections = 0;
 
@@ -1060,43 +1067,64 @@ class _NativeSocket extends _NativeSocketNativeWrapper with _ServiceObject {
     }
     if (isClosing || isClosed) return null;
     try {
-      Uint8List? list;
+      Uint8List buffer;
+      int length = 0;
       if (count != null) {
-        list = nativeRead(count);
-        available = nativeAvailable();
+        // Do not allocate more than is known to be available, the rest of
+        // the buffer would never be filled.
+        buffer = Uint8List(
+            (available > 0 && available < count) ? available : count);
+        length = _readInto(buffer, 0, buffer.length);
       } else {
         // If count is null, read as many bytes as possible.
         // Loop here to ensure bytes that arrived while this read was
-        // issued are also read.
-        BytesBuilder builder = BytesBuilder();
+        // issued are also read. The bytes are read directly into a single
+        // buffer which only grows if more bytes arrive during the read.
+        buffer = Uint8List(available);
         do {
           assert(available > 0);
-          list = nativeRead(available);
-          if (list == null) {
+          if (length + available > buffer.length) {
+            int newLength = buffer.length * 2;
+            if (newLength < length + available) newLength = length + available;
+            buffer = Uint8List(newLength)..setRange(0, length, buffer);
+          }
+          final int bytesRead = _readInto(buffer, length, length + available);
+          if (bytesRead == 0) {
             break;
           }
-          builder.add(list);
-          available = nativeAvailable();
+          length += bytesRead;
         } while (available > 0);
-        if (builder.isEmpty) {
-          list = null;
-        } else {
-          list = builder.toBytes();
-        }
       }
-      if (!const bool.fromEnvironment("dart.vm.product")) {
-        _SocketProfile.collectStatistic(
-            nativeGetSocketId(), _SocketProfileType.readBytes, list?.length);
+      if (length == 0) {
+        // On MacOS when reading from a tty Ctrl-D will result in reading one
+        // less byte then reported as available.
+        return null;
       }
-      return list;
+      // The result owns its whole buffer, so copy on short reads rather
+      // than returning a view which would keep the larger buffer alive.
+      return length == buffer.length ? buffer : buffer.sublist(0, length);
     } catch (e) {
       reportError(e, StackTrace.current, "Read failed");
       return null;
     }
   }
 
+  // Reads up to `end - start` bytes directly into [buffer]. Returns the
+  // number of bytes read and updates [available]. Throws on errors.
+  int _readInto(Uint8List buffer, int start, int end) {
+    final int bytesRead = nativeReadInto(buffer, start, end - start);
+    available = nativeAvailable();
+    if (!const bool.fromEnvironment("dart.vm.product")) {
+      _SocketProfile.collectStatistic(
+          nativeGetSocketId(), _SocketProfileType.readBytes, bytesRead);
+    }
+    return bytesRead;
+  }
+
   Datagram? receive() {
     if (isClosing || isClosed) return null;
+    final batch = _datagrams;
+    if (batch != null) return _receiveBatched(batch);
     try {
       Datagram? result = nativeRecvFrom();
       if (!const bool.fromEnvironment("dart.vm.product")) {
@@ -1104,6 +1132,11 @@ class _NativeSocket extends _NativeSocketNativeWrapper with _ServiceObject {
             _SocketProfileType.readBytes, result?.data.length);
       }
       _availableDatagram = nativeAvailableDatagram();
+      if (_availableDatagram) {
+        // Datagrams are queuing up, receive the following ones in batches.
+        _datagrams = _DatagramBatch(
+            _DatagramBatch.receiveCapacity, _DatagramBatch.maxDatagramLength);
+      }
       return result;
     } catch (e) {
       reportError(e, StackTrace.current, "Receive failed");
@@ -1111,6 +1144,58 @@ class _NativeSocket extends _NativeSocketNativeWrapper with _ServiceObject {
     }
   }
 
+  Datagram? _receiveBatched(_DatagramBatch batch) {
+    if (_nextDatagram == batch.count) {
+      _nextDatagram = 0;
+      if (receiveBatch(batch) == 0) {
+        _datagrams = null;
+        return null;
+      }
+    }
+    final int i = _nextDatagram++;
+    if (!_hasBatchedDatagram && !_availableDatagram) {
+      // The queue is drained, don't hold on to the batch buffers while the
+      // socket is idle. The datagram is copied out below.
+      _datagrams = null;
+      _nextDatagram = 0;
+    }
+    _availableDatagram = _hasBatchedDatagram || _availableDatagram;
+    // Like nativeRecvFrom, consume empty datagrams without a result.
+    if (batch.length(i) == 0) return null;
+    return batch.datagram(i);
+  }
+
+  bool get _hasBatchedDatagram {
+    final batch = _datagrams;
+    return batch != null && _nextDatagram < batch.count;
+  }
+
+  // Receives as many datagrams as fit into [batch] with a single native
+  // call, reading them directly into its shared buffer. Returns the number
+  // of datagrams received.
+  int receiveBatch(_DatagramBatch batch) {
+    batch.count = 0;
+    if (isClosing || isClosed) return 0;
+    try {
+      final int count = nativeRecvFromBatch(
+          batch.data, batch.slotSize, batch._info, batch._addresses);
+      batch.count = count;
+      if (!const bool.fromEnvironment("dart.vm.product")) {
+        int bytes = 0;
+        for (int i = 0; i < count; i++) {
+          bytes += batch.length(i);
+        }
+        _SocketProfile.collectStatistic(
+            nativeGetSocketId(), _SocketProfileType.readBytes, bytes);
+      }
+      _availableDatagram = nativeAvailableDatagram();
+      return count;
+    } catch (e) {
+      reportError(e, StackTrace.current, "Receive failed");
+      return 0;
+    }
+  }
+
   SocketMessage? readMessage([int? count]) {
     if (count != null && count <= 0) {
       throw ArgumentError("Illegal length $count");
@@ -1193,6 +1278,95 @@ class _NativeSocket extends _NativeSocketNativeWrapper with _ServiceObject {
     }
   }
 
+  // Must match SocketBase::kMaxWriteVBuffers.
+  static const int _maxWriteVectorBuffers = 64;
+
+  // Writes as much as possible of [buffers], in order, issuing one vectored
+  // write for every [_maxWriteVectorBuffers] buffers instead of one write
+  // per buffer. The first buffer is written from [offset]. Returns the total
+  // number of bytes written, which can end in the middle of a buffer.
+  int writeVector(List<List<int>> buffers, [int offset = 0]) {
+    if (buffers.isNotEmpty) {
+      RangeError.checkValueInInterval(offset, 0, buffers[0].length, "offset");
+    }
+    if (isClosing || isClosed) return 0;
+    int total = 0;
+    try {
+      int index = 0;
+      while (index < buffers.length) {
+        final int end = min(index + _maxWriteVectorBuffers, buffers.length);
+        final chunk = <List<int>>[];
+        final offsets = <int>[];
+        final lengths = <int>[];
+        int bytes = 0;
+        for (; index < end; index++) {
+          final buffer = buffers[index];
+          final int start = index == 0 ? offset : 0;
+          final int length = buffer.length - start;
+          if (length == 0) continue;
+          _BufferAndStart bufferAndStart =
+              _ensureFastAndSerializableByteData(buffer, start, buffer.length);
+          chunk.add(bufferAndStart.buffer);
+          offsets.add(bufferAndStart.start);
+          lengths.add(length);
+          bytes += length;
+        }
+        if (chunk.isEmpty) continue;
+        int result = nativeWriteVector(chunk, offsets, lengths);
+        // As for write, a negative result is a short write forced for
+        // testing, which may not trigger a write event.
+        final bool forcedShortWrite = result < 0;
+        if (forcedShortWrite) result = -result;
+        total += result;
+        if (result < bytes) {
+          if (!forcedShortWrite) writeAvailable = false;
+          break;
+        }
+      }
+      return total;
+    } catch (e) {
+      StackTrace st = StackTrace.current;
+      scheduleMicrotask(() => reportError(e, st, "Write failed"));
+      return total;
+    } finally {
+      if (!const bool.fromEnvironment("dart.vm.product")) {
+        _SocketProfile.collectStatistic(
+            nativeGetSocketId(), _SocketProfileType.writeBytes, total);
+      }
+    }
+  }
+
+  // Writes up to [count] bytes of [file], starting at [offset], to the socket
+  // without copying them into Dart. The file is read on the IO service
+  // thread, so that a slow disk does not block the isolate. Completes with
+  // the number of bytes written, or -1 if [offset] is at or past the end of
+  // the file. As for write, a short write clears [writeAvailable] and the
+  // rest can be sent on the next write event. [file] must not be closed
+  // before the returned future completes.
+  Future<int> sendFile(RandomAccessFile file, int offset, int count) {
+    if (offset < 0) throw new RangeError.value(offset);
+    if (count < 0) throw new RangeError.value(count);
+    if (isClosing || isClosed || count == 0) return new Future.value(0);
+    // The request gets its own descriptor for the socket, so closing the
+    // socket meanwhile cannot make it write to an unrelated descriptor.
+    final int fd = nativeDuplicateFd();
+    final int pointer = (file as _RandomAccessFile)._pointer();
+    return _IOService._dispatch(
+        _IOService.socketSendFile, [fd, pointer, offset, count]).then((result) {
+      if (_isErrorResponse(result)) {
+        throw _exceptionFromResponse(result, "Send file failed", file.path);
+      }
+      if (result > 0 && !const bool.fromEnvironment("dart.vm.product")) {
+        _SocketProfile.collectStatistic(
+            nativeGetSocketId(), _SocketProfileType.writeBytes, result);
+      }
+      if (result >= 0 && result < count) {
+        writeAvailable = false;
+      }
+      return result as int;
+    });
+  }
+
   int send(List<int> buffer, int offset, int bytes, InternetAddress address,
       int port) {
     _throwOnBadPort(port);
@@ -1382,7 +1556,8 @@ class _NativeSocket extends _NativeSocketNativeWrapper with _ServiceObject {
             connections++;
           } else {
             if (isUdp) {
-              _availableDatagram = nativeAvailableDatagram();
+              _availableDatagram =
+                  _hasBatchedDatagram || nativeAvailableDatagram();
             } else {
               available = nativeAvailable();
             }
@@ -1646,17 +1821,25 @@ class _NativeSocket extends _NativeSocketNativeWrapper with _ServiceObject {
   external int nativeAvailable();
   @pragma("vm:external-name", "Socket_AvailableDatagram")
   external bool nativeAvailableDatagram();
-  @pragma("vm:external-name", "Socket_Read")
-  external Uint8List? nativeRead(int len);
+  @pragma("vm:external-name", "Socket_ReadInto")
+  external int nativeReadInto(Uint8List buffer, int offset, int bytes);
   @pragma("vm:external-name", "Socket_RecvFrom")
   external Datagram? nativeRecvFrom();
+  @pragma("vm:external-name", "Socket_RecvFromBatch")
+  external int nativeRecvFromBatch(
+      Uint8List buffer, int slotSize, Int64List info, Uint8List addresses);
   @pragma("vm:external-name", "Socket_ReceiveMessage")
   external List<dynamic> nativeReceiveMessage(int len);
   @pragma("vm:external-name", "Socket_WriteList")
   external int nativeWrite(List<int> buffer, int offset, int bytes);
+  @pragma("vm:external-name", "Socket_WriteVector")
+  external int nativeWriteVector(
+      List<List<int>> buffers, List<int> offsets, List<int> lengths);
   @pragma("vm:external-name", "Socket_SendTo")
   external int nativeSendTo(
       List<int> buffer, int offset, int bytes, Uint8List address, int port);
+  @pragma("vm:external-name", "Socket_DuplicateFd")
+  external int nativeDuplicateFd();
   @pragma("vm:external-name", "Socket_SendMessage")
   external nativeSendMessage(
       List<int> buffer, int offset, int bytes, List<dynamic> controlMessages);
@@ -2052,12 +2235,32 @@ class Socket {
 }
 
 class _SocketStreamConsumer extends StreamConsumer<List<int>> {
+  // While a write is pending, chunks from the stream are collected up to
+  // this many bytes before the stream is paused. They are then written with
+  // a single vectored write once the socket is writable again.
+  static const int _maxPendingBytes = 64 * 1024;
+  // Streams from File.openRead over at least this many bytes are sent to
+  // plain sockets directly from the file, see [_addFileStream].
+  static const int _minSendFileBytes = 64 * 1024;
+
   StreamSubscription? subscription;
   final _Socket socket;
-  int? offset;
-  List<int>? buffer;
+  // The chunks which have not been written completely, and the offset of the
+  // first unwritten byte in the first of them.
+  final List<List<int>> buffers = <List<int>>[];
+  int offset = 0;
+  int pendingBytes = 0;
   bool paused = false;
+  // Set when the stream is done while chunks are still pending. The stream
+  // completes once they have been written.
+  bool streamDone = false;
   Completer<Socket>? streamCompleter;
+  // The file sent in place of a file stream, and the region left to send.
+  RandomAccessFile? file;
+  int filePosition = 0;
+  int fileEnd = 0;
+  // Set while a send from [file] is pending on the IO service.
+  bool sendingFile = false;
 
   _SocketStreamConsumer(this.socket);
 
@@ -2065,26 +2268,105 @@ class _SocketStreamConsumer extends StreamConsumer<List<int>> {
     socket._ensureRawSocketSubscription();
     final completer = streamCompleter = new Completer<Socket>();
     if (socket._raw != null) {
-      subscription = stream.listen((data) {
-        assert(!paused);
-        assert(buffer == null);
-        buffer = data;
-        offset = 0;
-        try {
+      if (stream is _FileStream &&
+          stream._path != null &&
+          stream._position >= 0 &&
+          socket._raw is _RawSocket &&
+          !Platform.isWindows &&
+          !Platform.isFuchsia) {
+        _addFileStream(stream, completer);
+      } else {
+        _listen(stream);
+      }
+    }
+    return completer.future;
+  }
+
+  // Sends the file of [stream] with sendfile instead of reading it into
+  // Dart. The file is opened once, and if its length is unknown or the
+  // region is too small it is read from that same handle instead. If it
+  // cannot be opened, [stream] is listened to, which reports the error.
+  Future<void> _addFileStream(
+      _FileStream stream, Completer<Socket> completer) async {
+    final int start = stream._position;
+    final int? end = stream._end;
+    RandomAccessFile opened;
+    try {
+      opened = await File(stream._path!).open();
+    } catch (_) {
+      if (identical(streamCompleter, completer) && socket._raw != null) {
+        _listen(stream);
+      }
+      return;
+    }
+    int? length;
+    try {
+      length = await opened.length();
+    } catch (_) {}
+    if (!identical(streamCompleter, completer) || socket._raw == null) {
+      // The socket was closed or destroyed in the meantime.
+      opened.close();
+      return;
+    }
+    if (length != null && end != null && end < length) length = end;
+    if (length == null || length - start < _minSendFileBytes) {
+      _listen(_readFile(opened, start, end));
+      return;
+    }
+    file = opened;
+    filePosition = start;
+    fileEnd = length;
+    write();
+  }
+
+  // Reads [file] from [start] up to [end], or up to its end, and closes it.
+  static Stream<List<int>> _readFile(
+      RandomAccessFile file, int start, int? end) async* {
+    try {
+      await file.setPosition(start);
+      int position = start;
+      while (end == null || position < end) {
+        int size = _blockSize;
+        if (end != null && end - position < size) size = end - position;
+        final Uint8List block = await file.read(size);
+        if (block.isEmpty) break;
+        position += block.length;
+        yield block;
+      }
+    } finally {
+      await file.close();
+    }
+  }
+
+  void _listen(Stream<List<int>> stream) {
+    subscription = stream.listen((data) {
+      assert(!paused);
+      if (data.isEmpty) return;
+      final bool writePending = buffers.isNotEmpty;
+      buffers.add(data);
+      pendingBytes += data.length;
+      try {
+        // A pending write continues on the next write event.
+        if (writePending) {
+          _pauseIfFull();
+        } else {
           write();
-        } catch (e) {
-          socket.destroy();
-          stop();
-          done(e);
         }
-      }, onError: (error, [stackTrace]) {
+      } catch (e) {
         socket.destroy();
-        done(error, stackTrace);
-      }, onDone: () {
+        stop();
+        done(e);
+      }
+    }, onError: (error, [stackTrace]) {
+      socket.destroy();
+      done(error, stackTrace);
+    }, onDone: () {
+      if (buffers.isEmpty) {
         done();
-      }, cancelOnError: true);
-    }
-    return completer.future;
+      } else {
+        streamDone = true;
+      }
+    }, cancelOnError: true);
   }
 
   Future<Socket> close() {
@@ -2093,27 +2375,106 @@ class _SocketStreamConsumer extends StreamConsumer<List<int>> {
   }
 
   void write() {
+    if (file != null) {
+      _writeFile();
+      return;
+    }
     final sub = subscription;
     if (sub == null) return;
     // Write as much as possible.
-    offset =
-        offset! + socket._write(buffer!, offset!, buffer!.length - offset!);
-    if (offset! < buffer!.length) {
-      if (!paused) {
-        paused = true;
-        sub.pause();
-      }
+    if (buffers.isNotEmpty) {
+      _consume(socket._writeBuffers(buffers, offset));
+    }
+    if (buffers.isNotEmpty) {
+      _pauseIfFull();
       socket._enableWriteEvent();
     } else {
-      buffer = null;
       if (paused) {
         paused = false;
         sub.resume();
       }
+      if (streamDone) {
+        streamDone = false;
+        done();
+      }
     }
   }
 
+  void _writeFile() {
+    final raw = socket._raw;
+    final opened = file;
+    if (raw is! _RawSocket || opened == null || sendingFile) return;
+    if (filePosition >= fileEnd) {
+      done();
+      return;
+    }
+    final Future<int> sent;
+    try {
+      sent = raw._socket.sendFile(opened, filePosition, fileEnd - filePosition);
+    } catch (e, st) {
+      socket.destroy();
+      done(e, st);
+      return;
+    }
+    sendingFile = true;
+    sent.then((written) {
+      sendingFile = false;
+      if (!identical(file, opened)) {
+        // Done or stopped while the send was pending.
+        opened.close();
+      } else if (written < 0) {
+        // The file was truncated. As when reading it, the stream just ends.
+        done();
+      } else if (written == 0) {
+        // The rest is sent on the next write event.
+        socket._enableWriteEvent();
+      } else {
+        filePosition += written;
+        _writeFile();
+      }
+    }, onError: (e, st) {
+      sendingFile = false;
+      if (!identical(file, opened)) {
+        opened.close();
+        return;
+      }
+      socket.destroy();
+      done(e, st);
+    });
+  }
+
+  void _closeFile() {
+    final opened = file;
+    if (opened == null) return;
+    file = null;
+    // A pending send closes the file once it completes.
+    if (!sendingFile) opened.close();
+  }
+
+  void _pauseIfFull() {
+    if (!paused && pendingBytes >= _maxPendingBytes) {
+      paused = true;
+      subscription!.pause();
+    }
+  }
+
+  // Drops the first [written] bytes from [buffers].
+  void _consume(int written) {
+    pendingBytes -= written;
+    int index = 0;
+    while (index < buffers.length) {
+      final int remaining = buffers[index].length - offset;
+      if (written < remaining) break;
+      written -= remaining;
+      offset = 0;
+      index++;
+    }
+    buffers.removeRange(0, index);
+    offset += written;
+  }
+
   void done([error, stackTrace]) {
+    _closeFile();
     final completer = streamCompleter;
     if (completer != null) {
       if (error != null) {
@@ -2126,11 +2487,16 @@ class _SocketStreamConsumer extends StreamConsumer<List<int>> {
   }
 
   void stop() {
+    _closeFile();
     final sub = subscription;
     if (sub == null) return;
     sub.cancel();
     subscription = null;
+    buffers.clear();
+    offset = 0;
+    pendingBytes = 0;
     paused = false;
+    streamDone = false;
     socket._disableWriteEvent();
   }
 }
@@ -2267,7 +2633,7 @@ class _Socket extends Stream<Uint8List> implements Socket {
     _detachReady = new Completer();
     _sink.close();
     return _detachReady.future.then((_) {
-      assert(_consumer.buffer == null);
+      assert(_consumer.buffers.isEmpty && _consumer.file == null);
       var raw = _raw;
       _raw = null;
       return [raw, _subscription];
@@ -2354,6 +2720,26 @@ class _Socket extends Stream<Uint8List> implements Socket {
     return 0;
   }
 
+  // Writes as much as possible of [buffers], the first one from [offset].
+  // Plain sockets write them with vectored writes, other raw sockets (such
+  // as secure sockets) one buffer at a time.
+  int _writeBuffers(List<List<int>> buffers, int offset) {
+    final raw = _raw;
+    if (raw == null) return 0;
+    if (raw is _RawSocket && buffers.length > 1) {
+      return raw._socket.writeVector(buffers, offset);
+    }
+    int total = 0;
+    for (final buffer in buffers) {
+      final int length = buffer.length - offset;
+      final int written = raw.write(buffer, offset, length);
+      total += written;
+      if (written < length) break;
+      offset = 0;
+    }
+    return total;
+  }
+
   void _enableWriteEvent() {
     _raw?.writeEventsEnabled = true;
   }
@@ -2533,6 +2919,66 @@ class _RawDatagramSocket extends Stream<RawSocketEvent>
   void setRawOption(RawSocketOption option) => _socket.setRawOption(option);
 }
 
+// Datagrams received by _NativeSocket.receiveBatch. The datagrams share a
+// single buffer: datagram i starts at offset(i) in [data] and is length(i)
+// bytes long. Datagrams longer than [slotSize] are truncated.
+class _DatagramBatch {
+  // Must match SocketBase::kMaxRecvDatagrams.
+  static const int maxCapacity = 64;
+  // Batch used by _NativeSocket.receive. Its slots fit any UDP datagram, like
+  // the receive buffer of Socket_RecvFrom, so nothing is truncated.
+  static const int receiveCapacity = 8;
+  static const int maxDatagramLength = 65536;
+  // Must match kDatagramInfoLength and kDatagramAddressLength in socket.cc.
+  static const int _infoLength = 3;
+  static const int _addressLength = _InternetAddress._IPv6AddrLength;
+
+  final int slotSize;
+  final Uint8List data;
+  final Int64List _info;
+  final Uint8List _addresses;
+  int count = 0;
+
+  // Datagrams usually come from a few peers, reuse the address of the
+  // previous datagram if it is the same.
+  _InternetAddress? _lastAddress;
+
+  _DatagramBatch(int capacity, this.slotSize)
+      : assert(capacity > 0 && slotSize > 0),
+        data = Uint8List(min(capacity, maxCapacity) * slotSize),
+        _info = Int64List(min(capacity, maxCapacity) * _infoLength),
+        _addresses = Uint8List(min(capacity, maxCapacity) * _addressLength);
+
+  int offset(int i) => i * slotSize;
+  int length(int i) => _info[i * _infoLength];
+  int port(int i) => _info[i * _infoLength + 1];
+
+  InternetAddress address(int i) {
+    final int start = i * _addressLength;
+    final int length = _info[i * _infoLength + 2] == 0
+        ? _InternetAddress._IPv4AddrLength
+        : _InternetAddress._IPv6AddrLength;
+    final last = _lastAddress;
+    if (last != null && _sameAddress(last._in_addr, start, length)) {
+      return last;
+    }
+    return _lastAddress = _InternetAddress.fromRawAddress(
+        _addresses.sublist(start, start + length));
+  }
+
+  bool _sameAddress(Uint8List rawAddress, int start, int length) {
+    if (rawAddress.length != length) return false;
+    for (int j = 0; j < length; j++) {
+      if (rawAddress[j] != _addresses[start + j]) return false;
+    }
+    return true;
+  }
+
+  // Copies datagram i out of the shared buffer.
+  Datagram datagram(int i) => Datagram(
+      data.sublist(offset(i), offset(i) + length(i)), address(i), port(i));
+}
+
 @pragma("vm:entry-point", "call")
 Datagram _makeDatagram(
     Uint8List data, String address, Uint8List in_addr, int port, int type) {
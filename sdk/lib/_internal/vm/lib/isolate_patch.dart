@@ -7,7 +7,13 @@
 /// used by patches of that library. We plan to change this when we have a
 /// shared front end and simply use parts.
 
-import "dart:_internal" show ClassID, VMLibraryHooks, patch;
+import "dart:_internal"
+    show
+        ClassID,
+        VMLibraryHooks,
+        extractTypeArguments,
+        makeFixedListUnmodifiable,
+        patch;
 
 import "dart:async"
     show Completer, Future, Stream, StreamController, StreamSubscription, Timer;
@@ -657,6 +663,89 @@ class Isolate {
     _exit(finalMessagePort, message);
   }
 
+  @patch
+  static T freeze<T>(T object) => _freeze(object, new Set<Object>.identity(),
+      new Map<Object, Object>.identity()) as T;
+
+  // [inProgress] holds the lists, maps and sets that are being frozen, which
+  // contain [object]. Meeting one of them again means the graph has a cycle.
+  // [frozen] maps the ones that are done to their copies, so that a
+  // collection that occurs more than once is only copied once.
+  static Object? _freeze(
+      Object? object, Set<Object> inProgress, Map<Object, Object> frozen) {
+    if (object == null || object is bool || object is num || object is String) {
+      return object;
+    }
+    if (object is TypedData) {
+      throw ArgumentError.value(
+          object, "object", "Typed data cannot be frozen");
+    }
+    if (object is! List && object is! Map && object is! Set) {
+      throw ArgumentError.value(object, "object",
+          "Only null, booleans, numbers, strings, lists, maps and sets "
+          "can be frozen");
+    }
+    final Object? done = frozen[object];
+    if (done != null) return done;
+    if (!inProgress.add(object)) {
+      throw ArgumentError.value(
+          object, "object", "Object graphs with cycles cannot be frozen");
+    }
+    final Object result = _freezeCollection(object, inProgress, frozen);
+    inProgress.remove(object);
+    frozen[object] = result;
+    return result;
+  }
+
+  static Object _freezeCollection(
+      Object object, Set<Object> inProgress, Map<Object, Object> frozen) {
+    if (object is List) {
+      return extractTypeArguments<List>(object, <E>() {
+        final copy = List<E>.of(object as List<E>, growable: false);
+        for (int i = 0; i < copy.length; i++) {
+          copy[i] = _freeze(copy[i], inProgress, frozen) as E;
+        }
+        return makeFixedListUnmodifiable(copy);
+      });
+    }
+    if (object is Map) {
+      return extractTypeArguments<Map>(object, <K, V>() {
+        // Keys and values alternate in the data of the frozen map.
+        final data = List<Object?>.filled(object.length * 2, null);
+        int i = 0;
+        object.forEach((key, value) {
+          data[i++] = _checkFrozenKey(key);
+          data[i++] = _freeze(value, inProgress, frozen) as V;
+        });
+        return _immutableMap<K, V>(makeFixedListUnmodifiable(data));
+      });
+    }
+    return extractTypeArguments<Set>(object as Set, <E>() {
+      final data = List<Object?>.filled(object.length, null);
+      int i = 0;
+      for (final element in object) {
+        data[i++] = _checkFrozenKey(element);
+      }
+      return _immutableSet<E>(makeFixedListUnmodifiable(data));
+    });
+  }
+
+  // Frozen maps and sets hash their keys the way constant maps and sets do,
+  // which is only consistent with == for these.
+  static Object? _checkFrozenKey(Object? key) {
+    if (key == null || key is bool || key is num || key is String) {
+      return key;
+    }
+    throw ArgumentError.value(key, "key",
+        "Only null, booleans, numbers and strings can be keys of frozen maps");
+  }
+
+  @pragma("vm:external-name", "Isolate_immutableMap")
+  external static Map<K, V> _immutableMap<K, V>(List data);
+
+  @pragma("vm:external-name", "Isolate_immutableSet")
+  external static Set<E> _immutableSet<E>(List data);
+
   /**
    * Creates an Uri representing the script which was compiled into kernel
    * binary in [kernelBlob].
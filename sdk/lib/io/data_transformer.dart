@@ -305,11 +305,9 @@ class ZLibEncoder extends Converter<List<int>, List<int>> {
   /// Convert a list of bytes using the options given to the ZLibEncoder
   /// constructor.
   List<int> convert(List<int> bytes) {
-    _BufferSink sink = new _BufferSink();
-    startChunkedConversion(sink)
-      ..add(bytes)
-      ..close();
-    return sink.builder.takeBytes();
+    RawZLibFilter filter = RawZLibFilter._makeZLibDeflateFilter(
+        gzip, level, windowBits, memLevel, strategy, dictionary, raw);
+    return filter._processAll(bytes, 0, bytes.length);
   }
 
   /// Start a chunked conversion using the options given to the [ZLibEncoder]
@@ -358,11 +356,9 @@ class ZLibDecoder extends Converter<List<int>, List<int>> {
   /// Convert a list of bytes using the options given to the [ZLibDecoder]
   /// constructor.
   List<int> convert(List<int> bytes) {
-    _BufferSink sink = new _BufferSink();
-    startChunkedConversion(sink)
-      ..add(bytes)
-      ..close();
-    return sink.builder.takeBytes();
+    RawZLibFilter filter =
+        RawZLibFilter._makeZLibInflateFilter(windowBits, dictionary, raw);
+    return filter._processAll(bytes, 0, bytes.length);
   }
 
   /// Start a chunked conversion.
@@ -421,6 +417,19 @@ abstract class RawZLibFilter {
   // TODO: Which stream?
   List<int>? processed({bool flush = true, bool end = false});
 
+  /// Processes [data] from [start] to [end] as the last input of the stream
+  /// and returns all of the output at once.
+  List<int> _processAll(List<int> data, int start, int end) {
+    BytesBuilder builder = new BytesBuilder(copy: false);
+    process(data, start, end);
+    while (true) {
+      final out = processed(end: true);
+      if (out == null) break;
+      builder.add(out);
+    }
+    return builder.takeBytes();
+  }
+
   external static RawZLibFilter _makeZLibDeflateFilter(
       bool gzip,
       int level,
@@ -434,26 +443,6 @@ abstract class RawZLibFilter {
       int windowBits, List<int>? dictionary, bool raw);
 }
 
-class _BufferSink extends ByteConversionSink {
-  final BytesBuilder builder = new BytesBuilder(copy: false);
-
-  void add(List<int> chunk) {
-    builder.add(chunk);
-  }
-
-  void addSlice(List<int> chunk, int start, int end, bool isLast) {
-    if (chunk is Uint8List) {
-      Uint8List list = chunk;
-      builder.add(new Uint8List.view(
-          list.buffer, list.offsetInBytes + start, end - start));
-    } else {
-      builder.add(chunk.sublist(start, end));
-    }
-  }
-
-  void close() {}
-}
-
 class _ZLibEncoderSink extends _FilterSink {
   _ZLibEncoderSink._(
       ByteConversionSink sink,
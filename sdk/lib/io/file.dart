@@ -850,6 +850,83 @@ abstract class RandomAccessFile {
   String get path;
 }
 
+/// Hints about how the bytes of a [MappedFileRegion] will be accessed.
+class MappedFileAdvice {
+  /// No particular access pattern. This is the default.
+  static const normal = const MappedFileAdvice._internal(0);
+
+  /// The bytes will be accessed in order, so more of the file can be read
+  /// ahead and pages can be dropped soon after they are accessed.
+  static const sequential = const MappedFileAdvice._internal(1);
+
+  /// The bytes will be accessed in no particular order, so reading ahead
+  /// does not help.
+  static const random = const MappedFileAdvice._internal(2);
+
+  /// The bytes will be accessed soon, so they can be read in now.
+  static const willNeed = const MappedFileAdvice._internal(3);
+
+  /// The region should use huge pages, where the platform supports them.
+  static const hugePage = const MappedFileAdvice._internal(4);
+
+  final int _advice;
+
+  const MappedFileAdvice._internal(this._advice);
+}
+
+/// A region of a file mapped into memory.
+///
+/// The [bytes] of a region access the file contents directly, without
+/// reading them into buffers first. Only the pages that are accessed are
+/// read from the file.
+///
+/// The mapping stays valid after the file is closed. It is removed once
+/// neither the region nor [bytes], or any view of it, is reachable.
+///
+/// **Truncation**: [mapSync] only maps regions that lie within the file.
+/// If the file is truncated while the region is mapped, by this or another
+/// process, accessing bytes past the new end of the file does not throw.
+/// On Linux, Android and macOS it terminates the process with `SIGBUS`.
+/// Only map files that are not truncated while they are mapped.
+abstract class MappedFileRegion {
+  /// Maps [length] bytes of [file], starting at [position], into memory.
+  ///
+  /// The region must lie within the file. Throws a [RangeError] if
+  /// [position] plus [length] is larger than the length of the file.
+  ///
+  /// Writes to the [bytes] of a [writable] region are written back to the
+  /// file only if the region is also [shared]. Otherwise they are private
+  /// to the region. A shared writable region needs a [file] opened for
+  /// writing, and is not supported on Fuchsia and Windows. On Windows the
+  /// region is read into memory instead of being mapped.
+  ///
+  /// [file] must have been opened by [File.open] or [File.openSync].
+  ///
+  /// Throws a [FileSystemException] if the region cannot be mapped.
+  static MappedFileRegion mapSync(RandomAccessFile file, int position,
+      int length, {bool writable = false, bool shared = false}) {
+    if (file is! _RandomAccessFile) {
+      throw new ArgumentError.value(file, "file", "Not opened by dart:io");
+    }
+    return file._mapSync(position, length,
+        writable: writable, shared: shared);
+  }
+
+  /// The contents of the region.
+  Uint8List get bytes;
+
+  /// Hints how bytes [start] to [end] of the region will be accessed.
+  ///
+  /// Hints the platform does not support are ignored.
+  void advise(MappedFileAdvice advice, [int start = 0, int? end]);
+
+  /// Writes modified bytes [start] to [end] back to the file.
+  ///
+  /// Only the writes to shared writable regions are written back. For other
+  /// regions this does nothing.
+  void sync([int start = 0, int? end]);
+}
+
 /// Exception thrown when a file operation fails.
 @pragma("vm:entry-point")
 class FileSystemException implements IOException {
@@ -524,14 +524,23 @@ class _File extends FileSystemEntity implements File {
       return completer.future;
     }
 
-    return open().then((file) {
-      return file.length().then((length) {
-        if (length == 0) {
-          // May be character device, try to read it in chunks.
-          return readDataChunked(file);
-        }
-        return file.read(length);
-      }).whenComplete(file.close);
+    // Open, read and close the file with a single request.
+    return _dispatchWithNamespace(_IOService.fileReadAll, [null, _rawPath])
+        .then((response) {
+      if (_isErrorResponse(response)) {
+        throw _exceptionFromResponse(response, "Cannot open file", path);
+      }
+      if (response != null) {
+        final data = response[1];
+        if (data is Uint8List) return data;
+        // The file was opened, reading it failed.
+        throw _exceptionFromResponse(data, "Cannot read file", path);
+      }
+      // The length is not known up front. May be character device, try to
+      // read it in chunks.
+      return open().then((file) {
+        return readDataChunked(file).whenComplete(file.close);
+      });
     });
   }
 
@@ -660,6 +669,41 @@ abstract class _RandomAccessFileOps {
   length();
   flush();
   lock(int lock, int start, int end);
+  map(int type, int position, int length);
+  mapAdvise(Uint8List mapping, int offset, int length, int advice);
+  mapSync(Uint8List mapping, int offset, int length);
+}
+
+class _MappedFileRegion implements MappedFileRegion {
+  final _RandomAccessFileOps _ops;
+  final String _path;
+  // The whole mapping, which starts at an aligned position before [bytes].
+  final Uint8List _mapping;
+  final int _offset;
+  final Uint8List bytes;
+
+  _MappedFileRegion(this._ops, this._path, Uint8List mapping, int length)
+      : _mapping = mapping,
+        _offset = mapping.length - length,
+        bytes = Uint8List.sublistView(
+            mapping, mapping.length - length, mapping.length);
+
+  void advise(MappedFileAdvice advice, [int start = 0, int? end]) {
+    end = RangeError.checkValidRange(start, end, bytes.length);
+    var result =
+        _ops.mapAdvise(_mapping, _offset + start, end - start, advice._advice);
+    if (result is OSError) {
+      throw new FileSystemException('advise failed', _path, result);
+    }
+  }
+
+  void sync([int start = 0, int? end]) {
+    end = RangeError.checkValidRange(start, end, bytes.length);
+    var result = _ops.mapSync(_mapping, _offset + start, end - start);
+    if (result is OSError) {
+      throw new FileSystemException('sync failed', _path, result);
+    }
+  }
 }
 
 @pragma("vm:entry-point")
@@ -1052,6 +1096,34 @@ class _RandomAccessFile implements RandomAccessFile {
     }
   }
 
+  // These values must match File::MapType in runtime/bin/file.h.
+  static const int _mapReadOnly = 0;
+  static const int _mapReadWrite = 2;
+  static const int _mapReadWriteShared = 3;
+
+  // See MappedFileRegion.mapSync.
+  _MappedFileRegion _mapSync(int position, int length,
+      {bool writable = false, bool shared = false}) {
+    _checkAvailable();
+    if (position < 0) throw new RangeError.value(position, "position");
+    if (length <= 0) throw new RangeError.value(length, "length");
+    // Accessing a mapping past the end of the file raises SIGBUS, which
+    // cannot be turned into an exception.
+    final int fileLength = lengthSync();
+    if (length > fileLength - position) {
+      throw new RangeError.range(
+          position + length, 0, fileLength, "position + length");
+    }
+    int type = writable
+        ? (shared ? _mapReadWriteShared : _mapReadWrite)
+        : _mapReadOnly;
+    var result = _ops.map(type, position, length);
+    if (result is OSError) {
+      throw new FileSystemException('map failed', path, result);
+    }
+    return new _MappedFileRegion(_ops, path, result, length);
+  }
+
   bool closed = false;
 
   int get fd => _ops.fd;
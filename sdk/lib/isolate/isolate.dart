@@ -589,6 +589,27 @@ class Isolate {
   /// receiving isolate will in most cases be able to receive the message
   /// in constant time.
   external static Never exit([SendPort? finalMessagePort, Object? message]);
+
+  /// Returns a deeply immutable copy of [object].
+  ///
+  /// `null`, booleans, numbers and strings are returned as they are. Lists,
+  /// maps and sets are copied into unmodifiable [List], [Map] and [Set]
+  /// implementations with the same type arguments, with their elements frozen
+  /// in turn. The keys of maps and the elements of sets must be `null`,
+  /// booleans, numbers or strings. Any other object, including typed data,
+  /// makes this method throw an [ArgumentError], as do object graphs with
+  /// cycles. A list, map or set that occurs more than once in [object] is
+  /// frozen once, and the copies of its occurrences are identical.
+  ///
+  /// The graph is walked recursively, so freezing collections nested many
+  /// thousands of levels deep can throw a [StackOverflowError].
+  ///
+  /// Sending the result to an isolate in the same isolate group, such as one
+  /// started with [spawn], passes it by reference instead of copying it. Large
+  /// read-only tables can therefore be frozen once and shared between all
+  /// isolates of a program.
+  @Since("2.19")
+  external static T freeze<T>(T object);
 }
 
 /// Sends messages to its [ReceivePort]s.
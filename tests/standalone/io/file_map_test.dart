@@ -0,0 +1,124 @@
+// Copyright (c) 2022, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+//
+// Tests MappedFileRegion.mapSync.
+
+import "dart:io";
+import "dart:typed_data";
+
+import "package:expect/expect.dart";
+
+const int fileSize = 3 * 4096 + 100;
+
+Uint8List makeData() {
+  final data = Uint8List(fileSize);
+  for (int i = 0; i < fileSize; i++) {
+    data[i] = (i * 31 + (i >> 8)) & 0xff;
+  }
+  return data;
+}
+
+void testRead(File file, Uint8List data) {
+  final opened = file.openSync();
+  try {
+    // Whole file, an unaligned region and the last byte.
+    for (final region in [
+      [0, fileSize],
+      [4097, 5000],
+      [fileSize - 1, 1],
+    ]) {
+      final position = region[0];
+      final length = region[1];
+      final mapped = MappedFileRegion.mapSync(opened, position, length);
+      Expect.equals(length, mapped.bytes.length);
+      Expect.listEquals(
+          Uint8List.sublistView(data, position, position + length),
+          mapped.bytes);
+      mapped.advise(MappedFileAdvice.sequential);
+      mapped.advise(MappedFileAdvice.willNeed, 0, length);
+      mapped.advise(MappedFileAdvice.hugePage);
+      mapped.sync();
+    }
+  } finally {
+    opened.closeSync();
+  }
+}
+
+void testOutOfRange(File file) {
+  final opened = file.openSync();
+  try {
+    Expect.throwsRangeError(
+        () => MappedFileRegion.mapSync(opened, 0, fileSize + 1));
+    Expect.throwsRangeError(
+        () => MappedFileRegion.mapSync(opened, fileSize, 1));
+    Expect.throwsRangeError(() => MappedFileRegion.mapSync(opened, -1, 1));
+    Expect.throwsRangeError(() => MappedFileRegion.mapSync(opened, 0, 0));
+    final mapped = MappedFileRegion.mapSync(opened, 0, 100);
+    Expect.throwsRangeError(() => mapped.sync(0, 101));
+    Expect.throwsRangeError(
+        () => mapped.advise(MappedFileAdvice.random, 50, 10));
+  } finally {
+    opened.closeSync();
+  }
+  Expect.throws<FileSystemException>(
+      () => MappedFileRegion.mapSync(opened, 0, 1));
+}
+
+void testClosedFile(File file, Uint8List data) {
+  final opened = file.openSync();
+  final mapped = MappedFileRegion.mapSync(opened, 100, 200);
+  opened.closeSync();
+  Expect.listEquals(Uint8List.sublistView(data, 100, 300), mapped.bytes);
+}
+
+void testPrivateWrite(File file, Uint8List data) {
+  final opened = file.openSync();
+  try {
+    final mapped =
+        MappedFileRegion.mapSync(opened, 0, fileSize, writable: true);
+    mapped.bytes[10] = data[10] ^ 0xff;
+    mapped.sync();
+    Expect.equals(data[10] ^ 0xff, mapped.bytes[10]);
+  } finally {
+    opened.closeSync();
+  }
+  Expect.listEquals(data, file.readAsBytesSync());
+}
+
+void testSharedWrite(File file, Uint8List data) {
+  final opened = file.openSync(mode: FileMode.append);
+  try {
+    if (Platform.isWindows || Platform.isFuchsia) {
+      Expect.throws<FileSystemException>(() => MappedFileRegion.mapSync(
+          opened, 0, fileSize,
+          writable: true, shared: true));
+      return;
+    }
+    final mapped = MappedFileRegion.mapSync(opened, 4096, 10,
+        writable: true, shared: true);
+    mapped.bytes[3] = data[4099] ^ 0xff;
+    mapped.sync();
+  } finally {
+    opened.closeSync();
+  }
+  final expected = Uint8List.fromList(data);
+  expected[4099] ^= 0xff;
+  Expect.listEquals(expected, file.readAsBytesSync());
+}
+
+main() {
+  final dir = Directory.systemTemp.createTempSync("file_map_test");
+  try {
+    final data = makeData();
+    final file = File("${dir.path}/data");
+    file.writeAsBytesSync(data);
+    testRead(file, data);
+    testOutOfRange(file);
+    testClosedFile(file, data);
+    testPrivateWrite(file, data);
+    testSharedWrite(file, data);
+  } finally {
+    dir.deleteSync(recursive: true);
+  }
+}
@@ -0,0 +1,63 @@
+// Copyright (c) 2022, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+//
+// Tests that datagrams queued up on a RawDatagramSocket, which are received
+// in batches, arrive intact and in order. Empty datagrams in the middle of a
+// batch are consumed without losing the datagrams behind them.
+
+import "dart:async";
+import "dart:io";
+import "dart:typed_data";
+
+import "package:async_helper/async_helper.dart";
+import "package:expect/expect.dart";
+
+const int datagramCount = 40;
+
+Uint8List datagram(int i) {
+  final int size = (i == 20) ? 9000 : (i % 10 == 1) ? 0 : 1 + (i * 37) % 1000;
+  final data = Uint8List(size);
+  for (int j = 0; j < size; j++) {
+    data[j] = (i + j) & 0xff;
+  }
+  return data;
+}
+
+main() async {
+  asyncStart();
+  final address = InternetAddress.loopbackIPv4;
+  final sender = await RawDatagramSocket.bind(address, 0);
+  final receiver = await RawDatagramSocket.bind(address, 0);
+
+  final expected = <Uint8List>[];
+  for (int i = 0; i < datagramCount; i++) {
+    final data = datagram(i);
+    Expect.equals(data.length, sender.send(data, address, receiver.port));
+    if (data.isNotEmpty) expected.add(data);
+  }
+
+  // All datagrams are queued before the receiver starts reading them.
+  final received = <Uint8List>[];
+  final done = Completer<void>();
+  final subscription = receiver.listen((event) {
+    if (event != RawSocketEvent.read) return;
+    final datagram = receiver.receive();
+    if (datagram == null) return;
+    Expect.equals(address, datagram.address);
+    Expect.equals(sender.port, datagram.port);
+    received.add(datagram.data);
+    if (received.length == expected.length) done.complete();
+  });
+  await done.future;
+
+  Expect.equals(expected.length, received.length);
+  for (int i = 0; i < expected.length; i++) {
+    Expect.listEquals(expected[i], received[i]);
+  }
+  Expect.isNull(receiver.receive());
+  await subscription.cancel();
+  receiver.close();
+  sender.close();
+  asyncEnd();
+}
@@ -4,6 +4,7 @@
 
 import 'dart:async';
 import 'dart:io';
+import 'dart:math';
 import 'dart:typed_data';
 
 import "package:async_helper/async_helper.dart";
@@ -245,6 +246,24 @@ void testZlibWithDictionary() {
   });
 }
 
+// Converts buffers that span several of the chunks in which whole buffers
+// are fed to zlib, both compressible and incompressible ones.
+void testZLibConvertLarge() {
+  var random = new Random(42);
+  var compressible = new Uint8List(300000);
+  var incompressible = new Uint8List(300000);
+  for (int i = 0; i < compressible.length; i++) {
+    compressible[i] = (i ~/ 100) & 0xff;
+    incompressible[i] = random.nextInt(256);
+  }
+  [compressible, incompressible].forEach((data) {
+    [true, false].forEach((gzip) {
+      var encoded = new ZLibEncoder(gzip: gzip).convert(data);
+      Expect.listEquals(data, new ZLibDecoder().convert(encoded));
+    });
+  });
+}
+
 var generateListTypes = [
   (list) => list,
   (list) => new Uint8List.fromList(list),
@@ -287,5 +306,6 @@ void main() {
   testZlibInflateThrowsWithSmallerWindow();
   testZlibInflateWithLargerWindow();
   testZlibWithDictionary();
+  testZLibConvertLarge();
   asyncEnd();
 }
@@ -0,0 +1,72 @@
+// Copyright (c) 2022, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+//
+// Tests that RawSocket.read returns exactly the bytes that were sent, both
+// with and without a count, and never more than the requested count. Each
+// result is a list of its own, not a view on a larger buffer.
+//
+// VMOptions=
+// VMOptions=--short_socket_read
+
+// @dart = 2.9
+
+import "dart:io";
+import "dart:typed_data";
+
+import "package:async_helper/async_helper.dart";
+import "package:expect/expect.dart";
+
+const int dataSize = 64 * 1024;
+
+Future<void> testRead({int count}) async {
+  final data = Uint8List(dataSize);
+  for (int i = 0; i < dataSize; i++) {
+    data[i] = i & 0xff;
+  }
+
+  final server = await RawServerSocket.bind(InternetAddress.loopbackIPv4, 0);
+  server.listen((RawSocket client) {
+    int written = 0;
+    client.listen((RawSocketEvent event) {
+      if (event == RawSocketEvent.write) {
+        written += client.write(data, written);
+        if (written < data.length) {
+          client.writeEventsEnabled = true;
+        } else {
+          client.shutdown(SocketDirection.send);
+        }
+      } else if (event == RawSocketEvent.readClosed) {
+        client.close();
+      }
+    });
+  });
+
+  final socket =
+      await RawSocket.connect(InternetAddress.loopbackIPv4, server.port);
+  final received = BytesBuilder(copy: false);
+  await for (final event in socket) {
+    if (event == RawSocketEvent.read) {
+      final chunk = socket.read(count);
+      if (chunk == null) continue;
+      Expect.isTrue(chunk.isNotEmpty);
+      if (count != null) Expect.isTrue(chunk.length <= count);
+      // Each chunk owns exactly its bytes.
+      Expect.equals(0, chunk.offsetInBytes);
+      Expect.equals(chunk.length, chunk.buffer.lengthInBytes);
+      received.add(chunk);
+    } else if (event == RawSocketEvent.readClosed) {
+      socket.close();
+    }
+  }
+  await server.close();
+  Expect.listEquals(data, received.takeBytes());
+}
+
+main() async {
+  asyncStart();
+  await testRead();
+  await testRead(count: 100);
+  await testRead(count: dataSize * 2);
+  asyncEnd();
+}
@@ -0,0 +1,89 @@
+// Copyright (c) 2022, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+//
+// Tests that File.openRead streams added to a Socket arrive intact. Large
+// regions are sent directly from the file, small ones through the stream.
+
+// @dart = 2.9
+
+import "dart:async";
+import "dart:io";
+import "dart:typed_data";
+
+import "package:async_helper/async_helper.dart";
+import "package:expect/expect.dart";
+
+const int fileSize = 1024 * 1024;
+
+Future<List<int>> sendThroughSocket(List<Stream<List<int>>> streams) async {
+  final server = await ServerSocket.bind(InternetAddress.loopbackIPv4, 0);
+  final received = Completer<List<int>>();
+  server.listen((Socket client) {
+    final builder = BytesBuilder(copy: false);
+    client.listen(builder.add, onDone: () {
+      received.complete(builder.takeBytes());
+      client.destroy();
+    });
+  });
+
+  final socket =
+      await Socket.connect(InternetAddress.loopbackIPv4, server.port);
+  for (final stream in streams) {
+    await socket.addStream(stream);
+  }
+  await socket.close();
+  final result = await received.future;
+  socket.destroy();
+  await server.close();
+  return result;
+}
+
+Future<void> testAddFileStream(File file, Uint8List data) async {
+  // Whole file, a region, a small region and a region past the end.
+  final streams = <Stream<List<int>>>[
+    file.openRead(),
+    file.openRead(1000, 300000),
+    file.openRead(17, 117),
+    file.openRead(fileSize - 70000, fileSize + 1000),
+  ];
+  final expected = BytesBuilder()
+    ..add(data)
+    ..add(Uint8List.sublistView(data, 1000, 300000))
+    ..add(Uint8List.sublistView(data, 17, 117))
+    ..add(Uint8List.sublistView(data, fileSize - 70000));
+  Expect.listEquals(expected.takeBytes(), await sendThroughSocket(streams));
+}
+
+Future<void> testMissingFile(File file) async {
+  final server = await ServerSocket.bind(InternetAddress.loopbackIPv4, 0);
+  server.listen((Socket client) {
+    client.listen(null, onError: (_) {}, onDone: client.destroy);
+  });
+  final socket =
+      await Socket.connect(InternetAddress.loopbackIPv4, server.port);
+  try {
+    await socket.addStream(file.openRead());
+    Expect.fail("Adding a missing file should fail");
+  } on FileSystemException catch (_) {}
+  socket.destroy();
+  await server.close();
+}
+
+main() async {
+  asyncStart();
+  final dir = await Directory.systemTemp.createTemp("socket_add_file_stream");
+  try {
+    final data = Uint8List(fileSize);
+    for (int i = 0; i < fileSize; i++) {
+      data[i] = (i * 7 + (i >> 8)) & 0xff;
+    }
+    final file = File("${dir.path}/data");
+    await file.writeAsBytes(data);
+    await testAddFileStream(file, data);
+    await testMissingFile(File("${dir.path}/missing"));
+  } finally {
+    await dir.delete(recursive: true);
+  }
+  asyncEnd();
+}
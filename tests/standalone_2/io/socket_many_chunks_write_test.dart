@@ -0,0 +1,85 @@
+// Copyright (c) 2022, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+//
+// Tests that many small chunks added to a Socket arrive intact and in order.
+// Chunks collected while a write is pending are written with vectored
+// writes, --short_socket_write forces partial writes of those.
+//
+// VMOptions=
+// VMOptions=--short_socket_write
+
+// @dart = 2.9
+
+import "dart:async";
+import "dart:io";
+import "dart:typed_data";
+
+import "package:async_helper/async_helper.dart";
+import "package:expect/expect.dart";
+
+// Builds chunks of varying sizes and kinds: typed data, views into a larger
+// buffer, plain lists, empty lists and a few large chunks.
+List<List<int>> buildChunks() {
+  final chunks = <List<int>>[];
+  int value = 0;
+  int next() => value++ & 0xff;
+  for (int i = 0; i < 2000; i++) {
+    final int size = (i % 50 == 0) ? 20000 : i % 97;
+    switch (i % 3) {
+      case 0:
+        final list = Uint8List(size);
+        for (int j = 0; j < size; j++) {
+          list[j] = next();
+        }
+        chunks.add(list);
+        break;
+      case 1:
+        final backing = Uint8List(size + 8);
+        for (int j = 0; j < size; j++) {
+          backing[4 + j] = next();
+        }
+        chunks.add(Uint8List.sublistView(backing, 4, 4 + size));
+        break;
+      default:
+        chunks.add(List<int>.generate(size, (_) => next()));
+        break;
+    }
+  }
+  return chunks;
+}
+
+Future<void> testManyChunks({bool flushEach}) async {
+  final chunks = buildChunks();
+  final expected = BytesBuilder();
+  chunks.forEach(expected.add);
+
+  final server = await ServerSocket.bind(InternetAddress.loopbackIPv4, 0);
+  final received = Completer<List<int>>();
+  server.listen((Socket client) {
+    final builder = BytesBuilder(copy: false);
+    client.listen(builder.add, onDone: () {
+      received.complete(builder.takeBytes());
+      client.destroy();
+    });
+  });
+
+  final socket =
+      await Socket.connect(InternetAddress.loopbackIPv4, server.port);
+  for (final chunk in chunks) {
+    socket.add(chunk);
+    if (flushEach) await socket.flush();
+  }
+  await socket.close();
+
+  Expect.listEquals(expected.takeBytes(), await received.future);
+  socket.destroy();
+  await server.close();
+}
+
+main() async {
+  asyncStart();
+  await testManyChunks(flushEach: false);
+  await testManyChunks(flushEach: true);
+  asyncEnd();
+}